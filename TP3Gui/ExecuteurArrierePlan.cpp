@@ -0,0 +1,209 @@
+/**
+ * \file ExecuteurArrierePlan.cpp
+ * \brief Implémentation des classes ControleTache et ExecuteurArrierePlan
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "ExecuteurArrierePlan.h"
+
+#include <exception>
+
+
+/**
+ * \brief Constructeur du contrôle, réservé à l'exécuteur
+ * \param[in] p_recepteur l'objet du GUI qui reçoit les avancements
+ * \param[in] p_avancement la fonction d'avancement de l'exécuteur
+ */
+ControleTache::ControleTache (QObject* p_recepteur, const std::function<void (int)>& p_avancement)
+  : m_recepteur (p_recepteur), m_avancement (p_avancement), m_annulee (false), m_dernierPourcentage (-1) { }
+
+
+/**
+ * \brief Indique si l'annulation de la tâche a été demandée
+ * \return true si la tâche doit s'arrêter au plus tôt
+ */
+bool ControleTache::estAnnulee () const
+{
+  return m_annulee.load (std::memory_order_relaxed);
+}
+
+
+/**
+ * \brief Rapporte l'avancement de la tâche au fil du GUI
+ *        Rien n'est posté si le pourcentage n'a pas changé depuis le dernier appel.
+ * \param[in] p_fait la quantité déjà traitée
+ * \param[in] p_total la quantité totale à traiter, 0 si inconnue
+ */
+void ControleTache::signalerAvancement (std::size_t p_fait, std::size_t p_total)
+{
+  const int pourcentage = p_total == 0 ? 100 : static_cast<int> (p_fait * 100 / p_total);
+  if (pourcentage == m_dernierPourcentage)
+    {
+      return;
+    }
+  m_dernierPourcentage = pourcentage;
+  const std::function<void (int)>& avancement = m_avancement;
+  QMetaObject::invokeMethod (m_recepteur, [&avancement, pourcentage] ()
+    {
+      if (avancement)
+        {
+          avancement (pourcentage);
+        }
+    }, Qt::QueuedConnection);
+}
+
+
+/**
+ * \brief Poste au fil du GUI une livraison partielle de la tâche
+ *        Les livraisons partielles sont exécutées dans l'ordre où elles sont postées, avant
+ *        la livraison finale; celles qui n'ont pas encore été exécutées au moment d'une
+ *        annulation sont ignorées.
+ * \param[in] p_livraison la fonction à exécuter sur le fil du GUI
+ */
+void ControleTache::livrerPartiel (std::function<void ()> p_livraison)
+{
+  QMetaObject::invokeMethod (m_recepteur, [this, p_livraison] ()
+    {
+      if (!estAnnulee ())
+        {
+          p_livraison ();
+        }
+    }, Qt::QueuedConnection);
+}
+
+
+/**
+ * \brief Constructeur de l'exécuteur
+ * \param[in] p_recepteur l'objet du GUI dont la boucle d'événements exécute les livraisons;
+ *            il doit posséder l'exécuteur afin de lui survivre
+ */
+ExecuteurArrierePlan::ExecuteurArrierePlan (QObject* p_recepteur)
+  : m_recepteur (p_recepteur), m_controle (p_recepteur, m_avancement), m_occupe (false) { }
+
+
+/**
+ * \brief Destructeur: annule la tâche en cours et attend la fin du fil
+ */
+ExecuteurArrierePlan::~ExecuteurArrierePlan ()
+{
+  annuler ();
+  if (m_fil.joinable ())
+    {
+      m_fil.join ();
+    }
+}
+
+
+/**
+ * \brief Assigne la fonction appelée sur le fil du GUI à chaque changement de pourcentage
+ * \param[in] p_avancement la fonction recevant un pourcentage de 0 à 100
+ */
+void ExecuteurArrierePlan::asgAvancement (std::function<void (int)> p_avancement)
+{
+  m_avancement = p_avancement;
+}
+
+
+/**
+ * \brief Assigne la fonction appelée sur le fil du GUI à la fin de chaque tâche
+ * \param[in] p_fin la fonction recevant un message vide en cas de succès,
+ *            sinon le message d'erreur ou d'annulation
+ */
+void ExecuteurArrierePlan::asgFin (std::function<void (const QString&)> p_fin)
+{
+  m_fin = p_fin;
+}
+
+
+/**
+ * \brief Lance une tâche sur le fil d'arrière-plan
+ * \param[in] p_tache la tâche à exécuter
+ * \return false si une tâche est déjà en cours, la nouvelle tâche n'étant pas lancée
+ */
+bool ExecuteurArrierePlan::lancer (Tache p_tache)
+{
+  if (m_occupe)
+    {
+      return false;
+    }
+  if (m_fil.joinable ())
+    {
+      m_fil.join ();
+    }
+  m_occupe = true;
+  m_controle.m_annulee = false;
+  m_controle.m_dernierPourcentage = -1;
+  m_fil = std::thread (&ExecuteurArrierePlan::executer, this, std::move (p_tache));
+  return true;
+}
+
+
+/**
+ * \brief Demande l'annulation de la tâche en cours; sa livraison ne sera pas exécutée
+ */
+void ExecuteurArrierePlan::annuler ()
+{
+  m_controle.m_annulee = true;
+}
+
+
+/**
+ * \brief Indique si une tâche est en cours
+ * \return true entre le lancement d'une tâche et l'appel de la fonction de fin
+ */
+bool ExecuteurArrierePlan::estOccupe () const
+{
+  return m_occupe;
+}
+
+
+/**
+ * \brief Corps du fil d'arrière-plan: exécute la tâche et poste sa livraison au fil du GUI
+ */
+void ExecuteurArrierePlan::executer (Tache p_tache)
+{
+  Livraison livraison;
+  QString erreur;
+  try
+    {
+      livraison = p_tache (m_controle);
+    }
+  catch (const std::exception& e)
+    {
+      erreur = QString::fromUtf8 (e.what ());
+    }
+  catch (...)
+    {
+      erreur = "Erreur inconnue pendant l'opération";
+    }
+  QMetaObject::invokeMethod (m_recepteur, [this, livraison, erreur] ()
+    {
+      terminer (livraison, erreur);
+    }, Qt::QueuedConnection);
+}
+
+
+/**
+ * \brief Termine la tâche sur le fil du GUI: exécute la livraison puis la fonction de fin
+ */
+void ExecuteurArrierePlan::terminer (const Livraison& p_livraison, const QString& p_erreur)
+{
+  m_fil.join ();
+  m_occupe = false;
+
+  QString message = p_erreur;
+  if (message.isEmpty () && m_controle.estAnnulee ())
+    {
+      message = "Opération annulée";
+    }
+  else if (message.isEmpty () && p_livraison)
+    {
+      p_livraison ();
+    }
+  if (m_fin)
+    {
+      m_fin (message);
+    }
+}
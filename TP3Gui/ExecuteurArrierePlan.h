@@ -0,0 +1,93 @@
+/**
+ * \file ExecuteurArrierePlan.h
+ * \brief Exécution des traitements lourds du GUI sur un fil d'arrière-plan.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef EXECUTEURARRIEREPLAN_H
+#define EXECUTEURARRIEREPLAN_H
+
+#include <QObject>
+#include <QString>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/**
+ * \class ControleTache
+ * \brief Vue qu'a une tâche d'arrière-plan sur son exécuteur.
+ *
+ *              La tâche consulte estAnnulee() entre deux étapes et rapporte son
+ *              avancement avec signalerAvancement(). Seuls les changements de
+ *              pourcentage sont transmis au fil du GUI, ce qui borne à 101 le
+ *              nombre d'événements postés, quel que soit le volume traité.
+ *              Une tâche qui produit son résultat par morceaux peut en livrer chacun
+ *              au fil du GUI avec livrerPartiel(), sans attendre sa fin.
+ */
+class ControleTache
+{
+public:
+  bool estAnnulee () const;
+  void signalerAvancement (std::size_t p_fait, std::size_t p_total);
+  void livrerPartiel (std::function<void ()> p_livraison);
+
+private:
+  friend class ExecuteurArrierePlan;
+  ControleTache (QObject* p_recepteur, const std::function<void (int)>& p_avancement);
+
+  QObject* m_recepteur;
+  const std::function<void (int)>& m_avancement;
+  std::atomic<bool> m_annulee;
+  int m_dernierPourcentage;
+};
+
+
+/**
+ * \class ExecuteurArrierePlan
+ * \brief Exécute une tâche à la fois sur un fil dédié et en livre le résultat au fil du GUI.
+ *
+ *              Une tâche reçoit un ControleTache et retourne une livraison: une fonction
+ *              exécutée sur le fil du GUI, par la boucle d'événements du récepteur, qui
+ *              est le seul endroit où la tâche peut modifier les objets affichés. Tant
+ *              qu'une tâche est en cours, elle peut lire les objets du GUI; c'est la
+ *              responsabilité de l'utilisateur de la classe de ne pas les modifier
+ *              pendant ce temps. Toute exception levée par la tâche est rapportée à la
+ *              fonction de fin sous forme de message.
+ *              Le destructeur annule la tâche en cours et attend sa fin; les livraisons
+ *              encore en attente sont détruites avec le récepteur sans être exécutées.
+ */
+class ExecuteurArrierePlan
+{
+public:
+  typedef std::function<void ()> Livraison;
+  typedef std::function<Livraison (ControleTache&)> Tache;
+
+  explicit ExecuteurArrierePlan (QObject* p_recepteur);
+  ~ExecuteurArrierePlan ();
+
+  void asgAvancement (std::function<void (int)> p_avancement);
+  void asgFin (std::function<void (const QString&)> p_fin);
+
+  bool lancer (Tache p_tache);
+  void annuler ();
+  bool estOccupe () const;
+
+private:
+  ExecuteurArrierePlan (const ExecuteurArrierePlan&) = delete;
+  ExecuteurArrierePlan& operator= (const ExecuteurArrierePlan&) = delete;
+
+  void executer (Tache p_tache);
+  void terminer (const Livraison& p_livraison, const QString& p_erreur);
+
+  QObject* m_recepteur;
+  std::function<void (int)> m_avancement;
+  std::function<void (const QString&)> m_fin;
+  ControleTache m_controle;
+  std::thread m_fil;
+  bool m_occupe;
+};
+
+#endif /* EXECUTEURARRIEREPLAN_H */
@@ -12,21 +12,90 @@
 #include "DialogAjoutCheque.h"
 #include "Cheque.h"
 #include "DialogSupprimer.h"
-#include "CompteException.h"
+#include "LecteurClients.h"
+#include "MoteurInteret.h"
+#include "Exportateur.h"
+#include "validationFichier.h"
+#include <QEvent>
+#include <QFileDialog>
+#include <QTimer>
+#include <QSettings>
+#include <QHeaderView>
+#include <QInputDialog>
 #include <QMessageBox>
+#include <QProgressBar>
+#include <QPushButton>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+const char* const CLE_DERNIER_CLIENT = "dernierClient";
+const std::size_t TAILLE_PREMIER_LOT = 256;
+const std::size_t TAILLE_LOT_MAX = 65536;
+}
 
 
 /** 
- * \brief constructeur par défaut
+ * \brief constructeur
  * 		  On construit un objet GestionCompteGUI en utilisant le frameworkQT.
  *                C'est la fenêtre d'accueil du GUI.
  * 		  Les attributs assignés sont celui d'un client par défaut. 
+ *                Les comptes sont présentés par une table dont les lignes ont une
+ *                hauteur fixe, ce qui permet à la vue de ne formater que les lignes visibles.
+ *                Si un fichier client est donné, ou à défaut si un client a été importé lors
+ *                d'une session précédente, son chargement est différé jusqu'à ce que la boucle
+ *                d'événements tourne, donc après l'affichage de la fenêtre, puis se fait en
+ *                arrière-plan; le temps jusqu'au premier affichage est mesuré depuis ce constructeur.
+ * \param[in] p_fichier le fichier du client à ouvrir au démarrage, vide pour le dernier client importé
  * \post L'objet construit a été initialisé et les informations du client sont affichés.
  */
-GestionCompteGUI::GestionCompteGUI () : m_client(3333, "Roti", "Poulet", util::Date(07, 9, 1988), "3336669999")
+GestionCompteGUI::GestionCompteGUI (const QString& p_fichier) : m_client(3333, "Roti", "Poulet", util::Date(07, 9, 1988), "3336669999"),
+                                                                m_modele(m_client), m_executeur(this), m_premierAffichage(-1),
+                                                                m_chargementComplet(-1), m_nbrRejets(0), m_attentePremierAffichage(false)
 {
+  m_chrono.start();
   widget.setupUi (this);
-  widget.afficherClient->setPlainText(m_client.reqReleves().c_str());
+  widget.afficherClient->setText(m_client.reqClientFormate().c_str());
+  widget.tableComptes->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  widget.tableComptes->setModel(&m_modele);
+  widget.tableComptes->viewport()->installEventFilter(this);
+
+  m_avancement = new QProgressBar(this);
+  m_avancement->setRange(0, 100);
+  m_annuler = new QPushButton("Annuler", this);
+  widget.statusbar->addPermanentWidget(m_avancement);
+  widget.statusbar->addPermanentWidget(m_annuler);
+  connect(m_annuler, SIGNAL(clicked()), this, SLOT(slotAnnulerTache()));
+  asgOccupe(false);
+
+  m_executeur.asgAvancement([this] (int p_pourcentage)
+    {
+      m_avancement->setValue(p_pourcentage);
+    });
+  m_executeur.asgFin([this] (const QString& p_message)
+    {
+      asgOccupe(false);
+      if (!p_message.isEmpty())
+        {
+          widget.statusbar->showMessage(p_message);
+        }
+    });
+
+  QString fichier = p_fichier.isEmpty() ? QSettings().value(CLE_DERNIER_CLIENT).toString() : p_fichier;
+  if (!fichier.isEmpty())
+    {
+      widget.afficherClient->setText("Chargement de " + fichier + "...");
+      QTimer::singleShot(0, this, [this, fichier] ()
+        {
+          chargerClient(fichier);
+        });
+    }
 }
 
 
@@ -45,22 +114,16 @@ void GestionCompteGUI::slotAjoutEpargne()
   DialogAjoutEpargne ajoutEpargne;
   if (ajoutEpargne.exec())
     {
-      try
-        {
-          bancaire::Epargne ep(ajoutEpargne.reqNoCompte(),
-                               ajoutEpargne.reqSolde(),
-                               ajoutEpargne.reqTauxInteret(),
-                               ajoutEpargne.reqDescription().toStdString());
-          m_client.ajouterCompte(ep);
-        
-        }
-      catch(CompteDejaPresentException& e)
+      bancaire::Epargne ep(ajoutEpargne.reqNoCompte(),
+                           ajoutEpargne.reqSolde(),
+                           ajoutEpargne.reqTauxInteret(),
+                           ajoutEpargne.reqDescription().toStdString());
+      if (m_modele.ajouterCompte(ep) == bancaire::ResultatCompte::COMPTE_DEJA_PRESENT)
         {
-          QString message = (e.what());
+          QString message = ep.reqCompteFormate().c_str();
           QMessageBox::information(this, "ERREUR:CE COMPTE EXISTE DÉJA", message);
         }
     }
-  widget.afficherClient->setPlainText(m_client.reqReleves().c_str());
 }
 
 
@@ -73,23 +136,18 @@ void GestionCompteGUI::slotAjoutCheque()
   DialogAjoutCheque ajoutCheque;
   if (ajoutCheque.exec())
     {
-      try
-        {
-          bancaire::Cheque ch(ajoutCheque.reqNoCompte(),        
-                              ajoutCheque.reqSolde(),
-                              ajoutCheque.reqTauxInteret(),
-                              ajoutCheque.reqNbTransactions(),
-                              ajoutCheque.reqTauxInteretMinimum(),
-                              ajoutCheque.reqDescription().toStdString());
-          m_client.ajouterCompte(ch);
-        }
-      catch(CompteDejaPresentException& e)
+      bancaire::Cheque ch(ajoutCheque.reqNoCompte(),        
+                          ajoutCheque.reqSolde(),
+                          ajoutCheque.reqTauxInteret(),
+                          ajoutCheque.reqNbTransactions(),
+                          ajoutCheque.reqTauxInteretMinimum(),
+                          ajoutCheque.reqDescription().toStdString());
+      if (m_modele.ajouterCompte(ch) == bancaire::ResultatCompte::COMPTE_DEJA_PRESENT)
         {
-          QString message = (e.what());
+          QString message = ch.reqCompteFormate().c_str();
           QMessageBox::information(this, "ERREUR:CE COMPTE EXISTE DÉJA", message);
         }
     }
-  widget.afficherClient->setPlainText(m_client.reqReleves().c_str());
 }
 
 /**
@@ -97,23 +155,363 @@ void GestionCompteGUI::slotAjoutCheque()
  * 
  * Ouvre la boîte de dialogue DialogSupprimer. Si un numéro de compte est fourni,
  * tente de le supprimer. Affiche une erreur si le compte est absent.
- * Met à jour l'affichage du relevé client.
+ * Seule la ligne du compte supprimé est retirée de la table.
  */
 void GestionCompteGUI::slotSupprimer()
 {
     DialogSupprimer supp;
 
     if (supp.exec()) {
-        try {
-            unsigned int numeroCompte = supp.reqNoCompte();
+        unsigned int numeroCompte = supp.reqNoCompte();
 
-            m_client.supprimerCompte(numeroCompte);
-        }
-        catch (CompteAbsentException &e) {
-            QString message = e.what();
+        if (m_modele.supprimerCompte(numeroCompte) == bancaire::ResultatCompte::COMPTE_ABSENT) {
+            QString message = "Le compte n'est pas présent dans la liste.";
             QMessageBox::information(this, "ERREUR", message);
         }
     }
+}
+
+/**
+ * \brief Charge en arrière-plan le premier client valide d'un fichier texte choisi par l'utilisateur
+ *        Le chemin est mémorisé afin que le client soit rouvert au prochain démarrage.
+ */
+void GestionCompteGUI::slotImporter()
+{
+  QString chemin = QFileDialog::getOpenFileName(this, "Importer un client");
+  if (chemin.isEmpty())
+    {
+      return;
+    }
+  QSettings().setValue(CLE_DERNIER_CLIENT, chemin);
+  m_chrono.start();
+  chargerClient(chemin);
+}
+
+
+/**
+ * \brief Calcule en arrière-plan les intérêts courus des comptes épargne depuis le 1er janvier
+ */
+void GestionCompteGUI::slotCalculerInterets()
+{
+  lancerTache("Calcul des intérêts en cours...", [this] (ControleTache& p_controle) -> ExecuteurArrierePlan::Livraison
+    {
+      util::Date aujourdhui;
+      bancaire::MoteurInteret moteur(util::Date(1, 1, aujourdhui.reqAnnee()), aujourdhui,
+                                     bancaire::ConventionJours::ACT_365);
+      const std::size_t nbrComptes = m_client.reqNbrComptes();
+      for (std::size_t i = 0; i < nbrComptes; i++)
+        {
+          if (p_controle.estAnnulee())
+            {
+              return nullptr;
+            }
+          if (const bancaire::Epargne* epargne = dynamic_cast<const bancaire::Epargne*>(&m_client.reqCompte(i)))
+            {
+              moteur.ajouterCompte(*epargne);
+            }
+          p_controle.signalerAvancement(i + 1, nbrComptes);
+        }
+      moteur.calculer();
+
+      const double total = moteur.reqTotal();
+      const std::size_t nbrEpargnes = moteur.reqNbrComptes();
+      return [this, total, nbrEpargnes] ()
+        {
+          widget.statusbar->showMessage(QString("Intérêts courus : %1$ sur %2 comptes épargne")
+                                        .arg(total, 0, 'f', 2).arg(nbrEpargnes));
+        };
+    });
+}
+
+
+/**
+ * \brief Exporte en arrière-plan le relevé du client en CSV ou en JSON Lines
+ */
+void GestionCompteGUI::slotExporter()
+{
+  QString filtre;
+  QString chemin = QFileDialog::getSaveFileName(this, "Exporter le relevé", QString(),
+                                                "CSV (*.csv);;JSON Lines (*.jsonl)", &filtre);
+  if (chemin.isEmpty())
+    {
+      return;
+    }
+  std::string fichier = chemin.toStdString();
+  bancaire::FormatExport format = filtre.startsWith("JSON") ? bancaire::FormatExport::JSON_LIGNES
+                                                            : bancaire::FormatExport::CSV;
+  lancerTache("Export en cours...", [this, fichier, format] (ControleTache& p_controle) -> ExecuteurArrierePlan::Livraison
+    {
+      int descripteur = ::open(fichier.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (descripteur < 0)
+        {
+          throw std::runtime_error("Impossible de créer le fichier " + fichier);
+        }
+      std::uint64_t nbrLignes = 0;
+      try
+        {
+          bancaire::Exportateur exportateur(descripteur, format);
+          exportateur.exporterClient(m_client);
+          exportateur.terminer();
+          nbrLignes = exportateur.reqNbrLignes();
+        }
+      catch (...)
+        {
+          ::close(descripteur);
+          throw;
+        }
+      ::close(descripteur);
+      p_controle.signalerAvancement(1, 1);
+
+      return [this, nbrLignes] ()
+        {
+          widget.statusbar->showMessage(QString("%1 lignes exportées").arg(nbrLignes));
+        };
+    });
+}
+
+
+/**
+ * \brief Supprime en arrière-plan les comptes dont le numéro est dans une plage
+ *        La suppression se fait sur une copie du client, qui remplace le client
+ *        affiché en une seule réinitialisation de la table.
+ */
+void GestionCompteGUI::slotSupprimerPlage()
+{
+  bool ok = false;
+  unsigned premier = QInputDialog::getInt(this, "Supprimer une plage", "Premier numéro de compte :",
+                                          10, 10, 99999, 1, &ok);
+  if (!ok)
+    {
+      return;
+    }
+  unsigned dernier = QInputDialog::getInt(this, "Supprimer une plage", "Dernier numéro de compte :",
+                                          premier, premier, 99999, 1, &ok);
+  if (!ok)
+    {
+      return;
+    }
+  lancerTache("Suppression en cours...", [this, premier, dernier] (ControleTache& p_controle) -> ExecuteurArrierePlan::Livraison
+    {
+      auto copie = std::make_shared<bancaire::Client>(m_client);
+      p_controle.signalerAvancement(1, 2);
+      if (p_controle.estAnnulee())
+        {
+          return nullptr;
+        }
+      const std::size_t nbrSupprimes = copie->supprimerComptes(premier, dernier);
+      auto index = std::make_shared<bancaire::IndexComptes>(*copie);
+      p_controle.signalerAvancement(2, 2);
+
+      return [this, copie, index, nbrSupprimes] ()
+        {
+          if (nbrSupprimes > 0)
+            {
+              m_modele.remplacerClient(std::move(*copie), std::move(*index));
+            }
+          widget.statusbar->showMessage(QString("%1 comptes supprimés").arg(nbrSupprimes));
+        };
+    });
+}
+
+
+/**
+ * \brief Annule le traitement d'arrière-plan en cours
+ */
+void GestionCompteGUI::slotAnnulerTache()
+{
+  m_executeur.annuler();
+  m_annuler->setEnabled(false);
+}
+
+
+/**
+ * \brief Filtre la table selon les champs de recherche
+ *        Un champ vide n'impose aucune contrainte; un solde qui n'est pas un nombre est ignoré.
+ */
+void GestionCompteGUI::slotFiltrer()
+{
+  bancaire::CritereRecherche critere;
+  critere.m_prefixeNumero = widget.rechercheNumero->text().trimmed().toStdString();
+  critere.m_prefixeDescription = widget.rechercheDescription->text().toStdString();
+  bool ok = false;
+  double solde = widget.rechercheSoldeMin->text().toDouble(&ok);
+  if (ok)
+    {
+      critere.m_soldeMin = solde;
+    }
+  solde = widget.rechercheSoldeMax->text().toDouble(&ok);
+  if (ok)
+    {
+      critere.m_soldeMax = solde;
+    }
+  m_modele.filtrer(critere);
+  if (critere.estVide())
+    {
+      widget.statusbar->clearMessage();
+    }
+  else
+    {
+      widget.statusbar->showMessage(QString("%1 comptes affichés").arg(m_modele.rowCount()));
+    }
+}
+
+
+/**
+ * \brief Charge en arrière-plan le premier client valide d'un fichier texte en remplissant la table au fil de la lecture
+ *        Le fichier a le format accepté par util::validerEnregistrements. Il est projeté en
+ *        mémoire plutôt que copié, la lecture commence donc sans attendre le reste du fichier.
+ *        L'en-tête du client et un premier petit lot de comptes sont livrés dès qu'ils sont
+ *        lus, ce qui donne un premier affichage rapide; les lots suivants, de taille croissante, sont ajoutés à la
+ *        table en un bloc de lignes chacun. Le temps écoulé depuis le départ de m_chrono
+ *        jusqu'à la fin du chargement, et jusqu'au premier dessin de la table qui suit la
+ *        livraison du client (voir eventFilter), est rapporté dans la barre d'état.
+ * \param[in] p_chemin le chemin du fichier
+ */
+void GestionCompteGUI::chargerClient(const QString& p_chemin)
+{
+  m_premierAffichage = -1;
+  m_chargementComplet = -1;
+  m_attentePremierAffichage = false;
+  std::string fichier = p_chemin.toStdString();
+  lancerTache("Chargement du client...", [this, fichier] (ControleTache& p_controle) -> ExecuteurArrierePlan::Livraison
+    {
+      util::FichierProjete projection(fichier);
+      bancaire::LecteurClients lecteur(projection.reqContenu());
+      std::optional<bancaire::Client> client = lecteur.lireClient();
+      if (!client)
+        {
+          throw std::runtime_error("Aucun client valide dans le fichier " + fichier);
+        }
 
-    widget.afficherClient->setPlainText(m_client.reqReleves().c_str());
-}
\ No newline at end of file
+      std::size_t tailleLot = TAILLE_PREMIER_LOT;
+      auto lot = std::make_shared<std::vector<std::unique_ptr<bancaire::Compte>>>();
+      bool premierLot = true;
+      auto livrerLot = [&] ()
+        {
+          if (premierLot)
+            {
+              client->essayerAjouterComptes(std::move(*lot));
+              auto resultat = std::make_shared<bancaire::Client>(std::move(*client));
+              auto index = std::make_shared<bancaire::IndexComptes>(*resultat);
+              p_controle.livrerPartiel([this, resultat, index] ()
+                {
+                  m_modele.remplacerClient(std::move(*resultat), std::move(*index));
+                  widget.afficherClient->setText(m_client.reqClientFormate().c_str());
+                  m_attentePremierAffichage = true;
+                });
+              premierLot = false;
+            }
+          else
+            {
+              p_controle.livrerPartiel([this, lot] ()
+                {
+                  m_modele.ajouterComptes(std::move(*lot));
+                });
+            }
+          lot = std::make_shared<std::vector<std::unique_ptr<bancaire::Compte>>>();
+          tailleLot = std::min(tailleLot * 2, TAILLE_LOT_MAX);
+        };
+
+      while (std::unique_ptr<bancaire::Compte> compte = lecteur.lireCompte())
+        {
+          if (p_controle.estAnnulee())
+            {
+              return nullptr;
+            }
+          lot->push_back(std::move(compte));
+          if (lot->size() == tailleLot)
+            {
+              livrerLot();
+            }
+          p_controle.signalerAvancement(lecteur.reqPosition(), lecteur.reqTaille());
+        }
+      if (premierLot || !lot->empty())
+        {
+          livrerLot();
+        }
+
+      const std::uint64_t nbrRejets = lecteur.reqNbrRejets();
+      return [this, nbrRejets] ()
+        {
+          m_nbrRejets = nbrRejets;
+          m_chargementComplet = m_chrono.elapsed();
+          rapporterChargement();
+        };
+    });
+}
+
+
+/**
+ * \brief Lance un traitement d'arrière-plan après avoir désactivé les actions qui modifient le client
+ * \param[in] p_description le message affiché dans la barre d'état pendant le traitement
+ * \param[in] p_tache le traitement; il peut lire m_client mais ne le modifie que dans sa livraison
+ */
+void GestionCompteGUI::lancerTache(const QString& p_description, ExecuteurArrierePlan::Tache p_tache)
+{
+  if (m_executeur.lancer(p_tache))
+    {
+      asgOccupe(true);
+      widget.statusbar->showMessage(p_description);
+    }
+}
+
+
+/**
+ * \brief Affiche dans la barre d'état le résultat et les temps du dernier chargement
+ *        Le temps du premier affichage n'est donné qu'une fois la table dessinée.
+ */
+void GestionCompteGUI::rapporterChargement()
+{
+  QString message = QString("%1 comptes chargés, %2 rejets").arg(m_client.reqNbrComptes()).arg(m_nbrRejets);
+  if (m_premierAffichage >= 0)
+    {
+      message += QString(" - premier affichage en %1 ms").arg(m_premierAffichage);
+    }
+  widget.statusbar->showMessage(message + QString(", chargement complet en %1 ms").arg(m_chargementComplet));
+}
+
+
+/**
+ * \brief Mesure le premier affichage d'un client chargé
+ *        Après la livraison du client, le premier événement de dessin de la table est
+ *        suivi d'une mesure différée, prise une fois ce dessin terminé.
+ * \param[in] p_objet l'objet qui reçoit l'événement
+ * \param[in] p_evenement l'événement
+ * \return false, l'événement est toujours transmis à son destinataire
+ */
+bool GestionCompteGUI::eventFilter(QObject* p_objet, QEvent* p_evenement)
+{
+  if (m_attentePremierAffichage && p_objet == widget.tableComptes->viewport() && p_evenement->type() == QEvent::Paint)
+    {
+      m_attentePremierAffichage = false;
+      QTimer::singleShot(0, this, [this] ()
+        {
+          m_premierAffichage = m_chrono.elapsed();
+          if (m_chargementComplet >= 0)
+            {
+              rapporterChargement();
+            }
+        });
+    }
+  return QMainWindow::eventFilter(p_objet, p_evenement);
+}
+
+
+/**
+ * \brief Active ou désactive les actions selon qu'un traitement d'arrière-plan est en cours
+ * \param[in] p_occupe true pendant un traitement
+ */
+void GestionCompteGUI::asgOccupe(bool p_occupe)
+{
+  widget.actionEpargne->setEnabled(!p_occupe);
+  widget.actionCheque->setEnabled(!p_occupe);
+  widget.actionSupprimer_un_compte_3->setEnabled(!p_occupe);
+  widget.actionImporter->setEnabled(!p_occupe);
+  widget.actionInterets->setEnabled(!p_occupe);
+  widget.actionExporter->setEnabled(!p_occupe);
+  widget.actionSupprimerPlage->setEnabled(!p_occupe);
+  m_avancement->setValue(0);
+  m_avancement->setVisible(p_occupe);
+  m_annuler->setVisible(p_occupe);
+  m_annuler->setEnabled(p_occupe);
+}
@@ -9,8 +9,15 @@
 #ifndef _GESTIONCOMPTEGUI_H
 #define _GESTIONCOMPTEGUI_H
 
+#include <QElapsedTimer>
+
 #include "ui_GestionCompteGUI.h"
 #include "Client.h"
+#include "ModeleComptes.h"
+#include "ExecuteurArrierePlan.h"
+
+class QProgressBar;
+class QPushButton;
 
 /**
  * \class GestionCompteGUI
@@ -22,27 +29,64 @@
  *              Epargne et Cheque du client également à supprimer un compte si nécessaire.
  *              La classe ajoute et suprrime que des comptes si le cas est valide.
  *              C'est la responsabilité de l'utilisateur de la classe de s'en asssurer.  
+ *              Les comptes sont affichés dans une table alimentée par un ModeleComptes:
+ *              un ajout ou une suppression ne met à jour que la ligne touchée.
+ *              Les traitements lourds (import, intérêts, export, suppression d'une
+ *              plage) s'exécutent sur un fil d'arrière-plan; pendant ce temps, les
+ *              actions qui modifient le client sont désactivées et l'avancement est
+ *              affiché dans la barre d'état avec un bouton d'annulation.
+ *              Au démarrage, le client d'un fichier est chargé après l'affichage de la
+ *              fenêtre et la table se remplit par lots au fil de la lecture.
  *            
  * \slotAjoutEpargne Slot de l'interface pour l'ajout d'un compte Epargne
  * \slotAjoutCheque  Slot de l'interface d'acceuil pour l'ajout d'un compte Cheque 
  * \slotSuprrimer    Slot de l'interface pour supprimer un compte existant du client,
  *                   après confirmation par boîte de dialogue. Gère les cas d'erreur.
+ * \slotImporter         Slot chargeant en arrière-plan le premier client d'un fichier texte choisi
+ * \slotCalculerInterets Slot calculant en arrière-plan les intérêts courus depuis le 1er janvier
+ * \slotExporter         Slot exportant en arrière-plan le relevé en CSV ou en JSON Lines
+ * \slotSupprimerPlage   Slot supprimant en arrière-plan les comptes d'une plage de numéros
+ * \slotAnnulerTache     Slot annulant le traitement d'arrière-plan en cours
+ * \slotFiltrer          Slot filtrant la table selon les champs de recherche
  */
 class GestionCompteGUI : public QMainWindow
 {
   Q_OBJECT
 public:
-  GestionCompteGUI ();
+  explicit GestionCompteGUI (const QString& p_fichier = QString());
   virtual ~GestionCompteGUI ();
+
+protected:
+  bool eventFilter(QObject* p_objet, QEvent* p_evenement) override;
   
   private slots:
       void slotAjoutEpargne();
       void slotAjoutCheque();
       void slotSupprimer();
+      void slotImporter();
+      void slotCalculerInterets();
+      void slotExporter();
+      void slotSupprimerPlage();
+      void slotAnnulerTache();
+      void slotFiltrer();
       
 private:
+  void chargerClient(const QString& p_chemin);
+  void lancerTache(const QString& p_description, ExecuteurArrierePlan::Tache p_tache);
+  void asgOccupe(bool p_occupe);
+  void rapporterChargement();
+
   Ui::GestionCompteGUI widget;
   bancaire::Client m_client;
+  ModeleComptes m_modele;
+  QProgressBar* m_avancement;
+  QPushButton* m_annuler;
+  ExecuteurArrierePlan m_executeur;
+  QElapsedTimer m_chrono;
+  qint64 m_premierAffichage;
+  qint64 m_chargementComplet;
+  std::uint64_t m_nbrRejets;
+  bool m_attentePremierAffichage;
 };
 
 #endif /* _GESTIONCOMPTEGUI_H */
@@ -0,0 +1,331 @@
+/**
+ * \file ModeleComptes.cpp
+ * \brief Implémentation de la classe ModeleComptes
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "ModeleComptes.h"
+#include "Cheque.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+
+/**
+ * \brief Constructeur du modèle
+ * \param[in] p_client le client dont les comptes sont présentés
+ * \param[in] p_parent l'objet Qt propriétaire du modèle
+ */
+ModeleComptes::ModeleComptes (bancaire::Client& p_client, QObject* p_parent)
+  : QAbstractTableModel (p_parent), m_client (p_client), m_index (p_client) { }
+
+
+/**
+ * \brief Retourne le nombre de lignes, soit le nombre de comptes retenus par le filtre
+ * \param[in] p_parent l'index parent, invalide pour une table
+ * \return le nombre de comptes présentés, 0 pour un parent valide
+ */
+int ModeleComptes::rowCount (const QModelIndex& p_parent) const
+{
+  if (p_parent.isValid ())
+    {
+      return 0;
+    }
+  return static_cast<int> (m_critere.estVide () ? m_client.reqNbrComptes () : m_rangs.size ());
+}
+
+
+/**
+ * \brief Retourne le nombre de colonnes de la table
+ * \param[in] p_parent l'index parent, invalide pour une table
+ * \return NB_COLONNES, 0 pour un parent valide
+ */
+int ModeleComptes::columnCount (const QModelIndex& p_parent) const
+{
+  return p_parent.isValid () ? 0 : NB_COLONNES;
+}
+
+
+/**
+ * \brief Formate une cellule à la demande de la vue
+ *        Le texte reprend le format de Compte::reqCompteFormate: taux à 3 chiffres
+ *        significatifs et solde arrondi au dollar.
+ * \param[in] p_index la cellule demandée
+ * \param[in] p_role le rôle demandé par la vue
+ * \return la valeur de la cellule, une valeur nulle pour un rôle non géré
+ */
+QVariant ModeleComptes::data (const QModelIndex& p_index, int p_role) const
+{
+  if (!p_index.isValid () || p_index.row () >= rowCount ())
+    {
+      return QVariant ();
+    }
+
+  const bancaire::Compte& compte = m_client.reqCompte (reqRangClient (p_index.row ()));
+  const bancaire::Cheque* cheque = dynamic_cast<const bancaire::Cheque*> (&compte);
+
+  if (p_role == Qt::TextAlignmentRole)
+    {
+      return p_index.column () >= TAUX_INTERET ? int (Qt::AlignRight | Qt::AlignVCenter)
+                                               : int (Qt::AlignLeft | Qt::AlignVCenter);
+    }
+  if (p_role == Qt::ToolTipRole && cheque != nullptr)
+    {
+      return QString ("Nombre de transactions : %1\nTaux d'intérêt minimum : %2")
+              .arg (cheque->reqNbrTransactions ())
+              .arg (cheque->reqTauxInteretMinimum (), 0, 'g', 3);
+    }
+  if (p_role != Qt::DisplayRole)
+    {
+      return QVariant ();
+    }
+
+  switch (p_index.column ())
+    {
+    case TYPE:
+      return cheque != nullptr ? QString ("Cheque") : QString ("Epargne");
+    case NUMERO:
+      return compte.reqNoCompte ();
+    case DESCRIPTION:
+      {
+        std::string_view description = compte.reqDescriptionVue ();
+        return QString::fromUtf8 (description.data (), static_cast<int> (description.size ()));
+      }
+    case DATE_OUVERTURE:
+      {
+        char tampon[util::Date::TAILLE_DATE_FORMATEE_MAX];
+        const char* fin = compte.reqDateOuvertureRef ().ecrireDateFormatee (tampon);
+        return QString::fromUtf8 (tampon, static_cast<int> (fin - tampon));
+      }
+    case TAUX_INTERET:
+      return QString::number (compte.reqTauxInteret (), 'g', 3);
+    case SOLDE:
+      return QString::number (compte.reqSolde (), 'f', 0) + "$";
+    default:
+      return QVariant ();
+    }
+}
+
+
+/**
+ * \brief Retourne les titres des colonnes
+ * \param[in] p_section la colonne ou la ligne
+ * \param[in] p_orientation l'en-tête horizontal ou vertical
+ * \param[in] p_role le rôle demandé par la vue
+ * \return le titre de la colonne, le rang à partir de 1 pour l'en-tête vertical
+ */
+QVariant ModeleComptes::headerData (int p_section, Qt::Orientation p_orientation, int p_role) const
+{
+  if (p_role != Qt::DisplayRole)
+    {
+      return QVariant ();
+    }
+  if (p_orientation == Qt::Vertical)
+    {
+      return p_section + 1;
+    }
+  switch (p_section)
+    {
+    case TYPE: return QString ("Type");
+    case NUMERO: return QString ("Numero");
+    case DESCRIPTION: return QString ("Description");
+    case DATE_OUVERTURE: return QString ("Date d'ouverture");
+    case TAUX_INTERET: return QString ("Taux d'intérêt");
+    case SOLDE: return QString ("Solde");
+    default: return QVariant ();
+    }
+}
+
+
+/**
+ * \brief Ajoute un compte au client et signale à la vue l'insertion d'une seule ligne
+ *        Lorsqu'un filtre est actif, la vue est plutôt réinitialisée avec le résultat
+ *        du filtre, puisque la présence de la nouvelle ligne dépend du filtre.
+ * \param[in] p_nouveauCompte le compte à ajouter
+ * \return SUCCES si le compte a été ajouté, COMPTE_DEJA_PRESENT sinon
+ * \post en cas de succès, le compte est indexé et, sans filtre, la vue affiche une ligne de plus à la fin
+ */
+bancaire::ResultatCompte ModeleComptes::ajouterCompte (const bancaire::Compte& p_nouveauCompte)
+{
+  if (reqRang (p_nouveauCompte.reqNoCompte ()) >= 0)
+    {
+      return bancaire::ResultatCompte::COMPTE_DEJA_PRESENT;
+    }
+  if (!m_critere.estVide ())
+    {
+      beginResetModel ();
+      bancaire::ResultatCompte resultat = m_client.essayerAjouterCompte (p_nouveauCompte);
+      m_index.ajouter (p_nouveauCompte);
+      appliquerFiltre ();
+      endResetModel ();
+      return resultat;
+    }
+  const int ligne = rowCount ();
+  beginInsertRows (QModelIndex (), ligne, ligne);
+  bancaire::ResultatCompte resultat = m_client.essayerAjouterCompte (p_nouveauCompte);
+  m_index.ajouter (p_nouveauCompte);
+  endInsertRows ();
+  return resultat;
+}
+
+
+/**
+ * \brief Ajoute un lot de comptes au client et signale à la vue l'insertion de leurs lignes en un bloc
+ *        Les comptes dont le numéro est déjà présent, dans le client ou plus tôt dans le lot,
+ *        sont ignorés. Lorsqu'un filtre est actif, la vue est réinitialisée une seule fois.
+ * \param[in] p_comptes les comptes à ajouter, déplacés dans le client; le vecteur est vidé
+ * \return le nombre de comptes ajoutés
+ */
+std::size_t ModeleComptes::ajouterComptes (std::vector<std::unique_ptr<bancaire::Compte>>&& p_comptes)
+{
+  std::unordered_set<unsigned> numerosLot;
+  p_comptes.erase (std::remove_if (p_comptes.begin (), p_comptes.end (),
+                                   [&] (const std::unique_ptr<bancaire::Compte>& p_compte)
+                                   {
+                                     const unsigned noCompte = p_compte->reqNoCompte ();
+                                     return reqRang (noCompte) >= 0 || !numerosLot.insert (noCompte).second;
+                                   }),
+                   p_comptes.end ());
+  const std::size_t nbrAjouts = p_comptes.size ();
+  if (nbrAjouts == 0)
+    {
+      return 0;
+    }
+
+  const bool filtre = !m_critere.estVide ();
+  const int ligne = rowCount ();
+  if (filtre)
+    {
+      beginResetModel ();
+    }
+  else
+    {
+      beginInsertRows (QModelIndex (), ligne, ligne + static_cast<int> (nbrAjouts) - 1);
+    }
+  m_index.ajouterComptes (p_comptes);
+  m_client.essayerAjouterComptes (std::move (p_comptes));
+  if (filtre)
+    {
+      appliquerFiltre ();
+      endResetModel ();
+    }
+  else
+    {
+      endInsertRows ();
+    }
+  return nbrAjouts;
+}
+
+
+/**
+ * \brief Supprime un compte du client et signale à la vue le retrait de sa seule ligne
+ * \param[in] p_noCompte le numéro du compte à supprimer
+ * \return SUCCES si le compte a été supprimé, COMPTE_ABSENT sinon
+ * \post en cas de succès, le compte n'est plus indexé et sa ligne, si elle était présentée, est retirée de la vue
+ */
+bancaire::ResultatCompte ModeleComptes::supprimerCompte (int p_noCompte)
+{
+  const int rang = reqRang (static_cast<unsigned> (p_noCompte));
+  if (rang < 0)
+    {
+      return bancaire::ResultatCompte::COMPTE_ABSENT;
+    }
+
+  int ligne = rang;
+  if (!m_critere.estVide ())
+    {
+      auto iter = std::lower_bound (m_rangs.begin (), m_rangs.end (), static_cast<std::uint32_t> (rang));
+      ligne = iter != m_rangs.end () && *iter == static_cast<std::uint32_t> (rang) ? iter - m_rangs.begin () : -1;
+    }
+  if (ligne >= 0)
+    {
+      beginRemoveRows (QModelIndex (), ligne, ligne);
+    }
+  bancaire::ResultatCompte resultat = m_client.essayerSupprimerCompte (p_noCompte);
+  m_index.retirer (rang);
+  appliquerFiltre ();
+  if (ligne >= 0)
+    {
+      endRemoveRows ();
+    }
+  return resultat;
+}
+
+
+/**
+ * \brief Remplace le client présenté, par exemple par le résultat d'un traitement d'arrière-plan
+ *        Le client et son index sont déplacés sans copie et la vue est réinitialisée une seule fois;
+ *        le filtre courant est appliqué au nouveau client.
+ * \param[in] p_client le nouveau client
+ * \param[in] p_index l'index du nouveau client, construit par l'appelant
+ */
+void ModeleComptes::remplacerClient (bancaire::Client&& p_client, bancaire::IndexComptes&& p_index)
+{
+  beginResetModel ();
+  m_client = std::move (p_client);
+  m_index = std::move (p_index);
+  appliquerFiltre ();
+  endResetModel ();
+}
+
+
+/**
+ * \brief Ne présente que les comptes qui satisfont un critère de recherche
+ * \param[in] p_critere le critère; un critère vide présente tous les comptes
+ */
+void ModeleComptes::filtrer (const bancaire::CritereRecherche& p_critere)
+{
+  beginResetModel ();
+  m_critere = p_critere;
+  appliquerFiltre ();
+  endResetModel ();
+}
+
+
+/**
+ * \brief Retourne le rang d'un compte dans le client
+ * \param[in] p_noCompte le numéro du compte recherché
+ * \return le rang du compte, -1 s'il est absent
+ */
+int ModeleComptes::reqRang (unsigned p_noCompte) const
+{
+  std::optional<std::uint32_t> rang = m_index.chercherNumero (p_noCompte);
+  return rang ? static_cast<int> (*rang) : -1;
+}
+
+
+/**
+ * \brief Retourne le client présenté par le modèle
+ * \return une référence constante sur le client
+ */
+const bancaire::Client& ModeleComptes::reqClient () const
+{
+  return m_client;
+}
+
+
+/**
+ * \brief Retourne le rang dans le client du compte présenté à une ligne
+ */
+std::size_t ModeleComptes::reqRangClient (int p_ligne) const
+{
+  return m_critere.estVide () ? static_cast<std::size_t> (p_ligne) : m_rangs[p_ligne];
+}
+
+
+/**
+ * \brief Recalcule les rangs présentés à partir de l'index
+ */
+void ModeleComptes::appliquerFiltre ()
+{
+  if (m_critere.estVide ())
+    {
+      m_rangs.clear ();
+    }
+  else
+    {
+      m_rangs = m_index.rechercher (m_critere);
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * \file ModeleComptes.h
+ * \brief Modèle Qt présentant les comptes d'un client sous forme de table.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef MODELECOMPTES_H
+#define MODELECOMPTES_H
+
+#include <QAbstractTableModel>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "Client.h"
+#include "IndexComptes.h"
+
+/**
+ * \class ModeleComptes
+ * \brief Modèle de table sur les comptes d'un client, une ligne par compte.
+ *
+ *              Le modèle ne conserve aucune copie des comptes: une cellule n'est
+ *              formatée que lorsque la vue la demande, c'est-à-dire pour les seules
+ *              lignes visibles. Les ajouts et suppressions doivent passer par le
+ *              modèle afin que la vue ne reçoive que l'insertion ou le retrait de
+ *              la ligne touchée plutôt qu'une réinitialisation complète.
+ *              Le modèle tient à jour un IndexComptes du client. Lorsqu'un filtre est
+ *              actif, seules les lignes des comptes retenus par l'index sont présentées,
+ *              dans l'ordre des comptes du client; appliquer un filtre ne coûte qu'une
+ *              recherche dans l'index et une réinitialisation de la vue.
+ *              Le client doit survivre au modèle, c'est la responsabilité de
+ *              l'utilisateur de la classe de s'en assurer.
+ */
+class ModeleComptes : public QAbstractTableModel
+{
+public:
+  /**
+   * \brief Colonnes de la table, dans l'ordre d'affichage
+   */
+  enum Colonne
+  {
+    TYPE,
+    NUMERO,
+    DESCRIPTION,
+    DATE_OUVERTURE,
+    TAUX_INTERET,
+    SOLDE,
+    NB_COLONNES
+  };
+
+  explicit ModeleComptes (bancaire::Client& p_client, QObject* p_parent = nullptr);
+
+  int rowCount (const QModelIndex& p_parent = QModelIndex ()) const override;
+  int columnCount (const QModelIndex& p_parent = QModelIndex ()) const override;
+  QVariant data (const QModelIndex& p_index, int p_role = Qt::DisplayRole) const override;
+  QVariant headerData (int p_section, Qt::Orientation p_orientation, int p_role = Qt::DisplayRole) const override;
+
+  bancaire::ResultatCompte ajouterCompte (const bancaire::Compte& p_nouveauCompte);
+  bancaire::ResultatCompte supprimerCompte (int p_noCompte);
+  std::size_t ajouterComptes (std::vector<std::unique_ptr<bancaire::Compte>>&& p_comptes);
+  void remplacerClient (bancaire::Client&& p_client, bancaire::IndexComptes&& p_index);
+  void filtrer (const bancaire::CritereRecherche& p_critere);
+  int reqRang (unsigned p_noCompte) const;
+  const bancaire::Client& reqClient () const;
+
+private:
+  std::size_t reqRangClient (int p_ligne) const;
+  void appliquerFiltre ();
+
+  bancaire::Client& m_client;
+  bancaire::IndexComptes m_index;
+  bancaire::CritereRecherche m_critere;
+  std::vector<std::uint32_t> m_rangs;
+};
+
+#endif /* MODELECOMPTES_H */
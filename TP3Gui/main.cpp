@@ -16,9 +16,12 @@ main (int argc, char *argv[])
   // Q_INIT_RESOURCE(resfile);
 
   QApplication app (argc, argv);
+  QApplication::setOrganizationName ("TP3");
+  QApplication::setApplicationName ("GestionCompteGUI");
 
-  // create and show your widgets here
-  GestionCompteGUI FenetrePrincipale;
+  // create and show your widgets here; the client file given as argument is loaded once the window is shown
+  QStringList arguments = app.arguments ();
+  GestionCompteGUI FenetrePrincipale (arguments.size () > 1 ? arguments.at (1) : QString ());
   FenetrePrincipale.show();
 
   return app.exec ();
@@ -22,8 +22,8 @@ QT_BEGIN_MOC_NAMESPACE
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_DEPRECATED
 struct qt_meta_stringdata_GestionCompteGUI_t {
-    QByteArrayData data[5];
-    char stringdata0[65];
+    QByteArrayData data[11];
+    char stringdata0[160];
 };
 #define QT_MOC_LITERAL(idx, ofs, len) \
     Q_STATIC_BYTE_ARRAY_DATA_HEADER_INITIALIZER_WITH_OFFSET(len, \
@@ -36,11 +36,20 @@ QT_MOC_LITERAL(0, 0, 16), // "GestionCompteGUI"
 QT_MOC_LITERAL(1, 17, 16), // "slotAjoutEpargne"
 QT_MOC_LITERAL(2, 34, 0), // ""
 QT_MOC_LITERAL(3, 35, 15), // "slotAjoutCheque"
-QT_MOC_LITERAL(4, 51, 13) // "slotSupprimer"
+QT_MOC_LITERAL(4, 51, 13), // "slotSupprimer"
+QT_MOC_LITERAL(5, 65, 12), // "slotImporter"
+QT_MOC_LITERAL(6, 78, 20), // "slotCalculerInterets"
+QT_MOC_LITERAL(7, 99, 12), // "slotExporter"
+QT_MOC_LITERAL(8, 112, 18), // "slotSupprimerPlage"
+QT_MOC_LITERAL(9, 131, 16), // "slotAnnulerTache"
+QT_MOC_LITERAL(10, 148, 11) // "slotFiltrer"
 
     },
     "GestionCompteGUI\0slotAjoutEpargne\0\0"
-    "slotAjoutCheque\0slotSupprimer"
+    "slotAjoutCheque\0slotSupprimer\0"
+    "slotImporter\0slotCalculerInterets\0"
+    "slotExporter\0slotSupprimerPlage\0"
+    "slotAnnulerTache\0slotFiltrer"
 };
 #undef QT_MOC_LITERAL
 
@@ -50,7 +59,7 @@ static const uint qt_meta_data_GestionCompteGUI[] = {
        8,       // revision
        0,       // classname
        0,    0, // classinfo
-       3,   14, // methods
+       9,   14, // methods
        0,    0, // properties
        0,    0, // enums/sets
        0,    0, // constructors
@@ -58,11 +67,23 @@ static const uint qt_meta_data_GestionCompteGUI[] = {
        0,       // signalCount
 
  // slots: name, argc, parameters, tag, flags
-       1,    0,   29,    2, 0x08 /* Private */,
-       3,    0,   30,    2, 0x08 /* Private */,
-       4,    0,   31,    2, 0x08 /* Private */,
+       1,    0,   59,    2, 0x08 /* Private */,
+       3,    0,   60,    2, 0x08 /* Private */,
+       4,    0,   61,    2, 0x08 /* Private */,
+       5,    0,   62,    2, 0x08 /* Private */,
+       6,    0,   63,    2, 0x08 /* Private */,
+       7,    0,   64,    2, 0x08 /* Private */,
+       8,    0,   65,    2, 0x08 /* Private */,
+       9,    0,   66,    2, 0x08 /* Private */,
+      10,    0,   67,    2, 0x08 /* Private */,
 
  // slots: parameters
+    QMetaType::Void,
+    QMetaType::Void,
+    QMetaType::Void,
+    QMetaType::Void,
+    QMetaType::Void,
+    QMetaType::Void,
     QMetaType::Void,
     QMetaType::Void,
     QMetaType::Void,
@@ -79,6 +100,12 @@ void GestionCompteGUI::qt_static_metacall(QObject *_o, QMetaObject::Call _c, int
         case 0: _t->slotAjoutEpargne(); break;
         case 1: _t->slotAjoutCheque(); break;
         case 2: _t->slotSupprimer(); break;
+        case 3: _t->slotImporter(); break;
+        case 4: _t->slotCalculerInterets(); break;
+        case 5: _t->slotExporter(); break;
+        case 6: _t->slotSupprimerPlage(); break;
+        case 7: _t->slotAnnulerTache(); break;
+        case 8: _t->slotFiltrer(); break;
         default: ;
         }
     }
@@ -114,13 +141,13 @@ int GestionCompteGUI::qt_metacall(QMetaObject::Call _c, int _id, void **_a)
     if (_id < 0)
         return _id;
     if (_c == QMetaObject::InvokeMetaMethod) {
-        if (_id < 3)
+        if (_id < 9)
             qt_static_metacall(this, _c, _id, _a);
-        _id -= 3;
+        _id -= 9;
     } else if (_c == QMetaObject::RegisterMethodArgumentMetaType) {
-        if (_id < 3)
+        if (_id < 9)
             *reinterpret_cast<int*>(_a[0]) = -1;
-        _id -= 3;
+        _id -= 9;
     }
     return _id;
 }
@@ -8,8 +8,8 @@ CONFIG -= debug_and_release app_bundle lib_bundle
 CONFIG += release 
 PKGCONFIG +=
 QT = core gui widgets
-SOURCES += DialogAjoutCheque.cpp DialogAjoutEpargne.cpp DialogSupprimer.cpp GestionCompteGUI.cpp main.cpp
-HEADERS += DialogAjoutCheque.h DialogAjoutEpargne.h DialogSupprimer.h GestionCompteGUI.h
+SOURCES += DialogAjoutCheque.cpp DialogAjoutEpargne.cpp DialogSupprimer.cpp ExecuteurArrierePlan.cpp GestionCompteGUI.cpp ModeleComptes.cpp main.cpp
+HEADERS += DialogAjoutCheque.h DialogAjoutEpargne.h DialogSupprimer.h ExecuteurArrierePlan.h GestionCompteGUI.h ModeleComptes.h
 FORMS += DialogAjoutCheque.ui DialogAjoutEpargne.ui DialogSupprimer.ui GestionCompteGUI.ui
 RESOURCES +=
 TRANSLATIONS +=
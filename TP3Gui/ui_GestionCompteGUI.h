@@ -12,11 +12,14 @@
 #include <QtCore/QVariant>
 #include <QtWidgets/QAction>
 #include <QtWidgets/QApplication>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
 #include <QtWidgets/QStatusBar>
-#include <QtWidgets/QTextEdit>
+#include <QtWidgets/QTableView>
 #include <QtWidgets/QWidget>
 
 QT_BEGIN_NAMESPACE
@@ -33,8 +36,17 @@ public:
     QAction *actionSupprimer_un_compte_3;
     QAction *actionEpargne;
     QAction *actionCheque;
+    QAction *actionImporter;
+    QAction *actionExporter;
+    QAction *actionInterets;
+    QAction *actionSupprimerPlage;
     QWidget *centralwidget;
-    QTextEdit *afficherClient;
+    QLabel *afficherClient;
+    QLineEdit *rechercheNumero;
+    QLineEdit *rechercheDescription;
+    QLineEdit *rechercheSoldeMin;
+    QLineEdit *rechercheSoldeMax;
+    QTableView *tableComptes;
     QMenuBar *menubar;
     QMenu *menuMenu;
     QMenu *menuAjouter;
@@ -63,11 +75,39 @@ public:
         actionEpargne->setObjectName(QString::fromUtf8("actionEpargne"));
         actionCheque = new QAction(GestionCompteGUI);
         actionCheque->setObjectName(QString::fromUtf8("actionCheque"));
+        actionImporter = new QAction(GestionCompteGUI);
+        actionImporter->setObjectName(QString::fromUtf8("actionImporter"));
+        actionExporter = new QAction(GestionCompteGUI);
+        actionExporter->setObjectName(QString::fromUtf8("actionExporter"));
+        actionInterets = new QAction(GestionCompteGUI);
+        actionInterets->setObjectName(QString::fromUtf8("actionInterets"));
+        actionSupprimerPlage = new QAction(GestionCompteGUI);
+        actionSupprimerPlage->setObjectName(QString::fromUtf8("actionSupprimerPlage"));
         centralwidget = new QWidget(GestionCompteGUI);
         centralwidget->setObjectName(QString::fromUtf8("centralwidget"));
-        afficherClient = new QTextEdit(centralwidget);
+        afficherClient = new QLabel(centralwidget);
         afficherClient->setObjectName(QString::fromUtf8("afficherClient"));
-        afficherClient->setGeometry(QRect(73, 14, 621, 481));
+        afficherClient->setGeometry(QRect(73, 14, 621, 81));
+        afficherClient->setAlignment(Qt::AlignLeading|Qt::AlignLeft|Qt::AlignTop);
+        rechercheNumero = new QLineEdit(centralwidget);
+        rechercheNumero->setObjectName(QString::fromUtf8("rechercheNumero"));
+        rechercheNumero->setGeometry(QRect(73, 100, 110, 25));
+        rechercheDescription = new QLineEdit(centralwidget);
+        rechercheDescription->setObjectName(QString::fromUtf8("rechercheDescription"));
+        rechercheDescription->setGeometry(QRect(188, 100, 200, 25));
+        rechercheSoldeMin = new QLineEdit(centralwidget);
+        rechercheSoldeMin->setObjectName(QString::fromUtf8("rechercheSoldeMin"));
+        rechercheSoldeMin->setGeometry(QRect(393, 100, 148, 25));
+        rechercheSoldeMax = new QLineEdit(centralwidget);
+        rechercheSoldeMax->setObjectName(QString::fromUtf8("rechercheSoldeMax"));
+        rechercheSoldeMax->setGeometry(QRect(546, 100, 148, 25));
+        tableComptes = new QTableView(centralwidget);
+        tableComptes->setObjectName(QString::fromUtf8("tableComptes"));
+        tableComptes->setGeometry(QRect(73, 130, 621, 365));
+        tableComptes->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        tableComptes->setAlternatingRowColors(true);
+        tableComptes->setSelectionBehavior(QAbstractItemView::SelectRows);
+        tableComptes->horizontalHeader()->setStretchLastSection(true);
         GestionCompteGUI->setCentralWidget(centralwidget);
         menubar = new QMenuBar(GestionCompteGUI);
         menubar->setObjectName(QString::fromUtf8("menubar"));
@@ -84,6 +124,12 @@ public:
         menubar->addAction(menuMenu->menuAction());
         menuMenu->addAction(menuAjouter->menuAction());
         menuMenu->addAction(actionSupprimer_un_compte_3);
+        menuMenu->addAction(actionSupprimerPlage);
+        menuMenu->addSeparator();
+        menuMenu->addAction(actionImporter);
+        menuMenu->addAction(actionExporter);
+        menuMenu->addAction(actionInterets);
+        menuMenu->addSeparator();
         menuMenu->addAction(actionQuitter_2);
         menuAjouter->addAction(actionEpargne);
         menuAjouter->addAction(actionCheque);
@@ -93,6 +139,14 @@ public:
         QObject::connect(actionEpargne, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotAjoutEpargne()));
         QObject::connect(actionCheque, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotAjoutCheque()));
         QObject::connect(actionSupprimer_un_compte_3, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotSupprimer()));
+        QObject::connect(actionImporter, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotImporter()));
+        QObject::connect(actionExporter, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotExporter()));
+        QObject::connect(actionInterets, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotCalculerInterets()));
+        QObject::connect(actionSupprimerPlage, SIGNAL(triggered()), GestionCompteGUI, SLOT(slotSupprimerPlage()));
+        QObject::connect(rechercheNumero, SIGNAL(textChanged(QString)), GestionCompteGUI, SLOT(slotFiltrer()));
+        QObject::connect(rechercheDescription, SIGNAL(textChanged(QString)), GestionCompteGUI, SLOT(slotFiltrer()));
+        QObject::connect(rechercheSoldeMin, SIGNAL(textChanged(QString)), GestionCompteGUI, SLOT(slotFiltrer()));
+        QObject::connect(rechercheSoldeMax, SIGNAL(textChanged(QString)), GestionCompteGUI, SLOT(slotFiltrer()));
 
         QMetaObject::connectSlotsByName(GestionCompteGUI);
     } // setupUi
@@ -109,6 +163,14 @@ public:
         actionSupprimer_un_compte_3->setText(QCoreApplication::translate("GestionCompteGUI", "Supprimer", nullptr));
         actionEpargne->setText(QCoreApplication::translate("GestionCompteGUI", "Epargne", nullptr));
         actionCheque->setText(QCoreApplication::translate("GestionCompteGUI", "Cheque", nullptr));
+        actionImporter->setText(QCoreApplication::translate("GestionCompteGUI", "Importer...", nullptr));
+        actionExporter->setText(QCoreApplication::translate("GestionCompteGUI", "Exporter...", nullptr));
+        actionInterets->setText(QCoreApplication::translate("GestionCompteGUI", "Calculer les int\303\251r\303\252ts", nullptr));
+        actionSupprimerPlage->setText(QCoreApplication::translate("GestionCompteGUI", "Supprimer une plage...", nullptr));
+        rechercheNumero->setPlaceholderText(QCoreApplication::translate("GestionCompteGUI", "Num\303\251ro", nullptr));
+        rechercheDescription->setPlaceholderText(QCoreApplication::translate("GestionCompteGUI", "Description", nullptr));
+        rechercheSoldeMin->setPlaceholderText(QCoreApplication::translate("GestionCompteGUI", "Solde minimum", nullptr));
+        rechercheSoldeMax->setPlaceholderText(QCoreApplication::translate("GestionCompteGUI", "Solde maximum", nullptr));
         menuMenu->setTitle(QCoreApplication::translate("GestionCompteGUI", "Menu", nullptr));
         menuAjouter->setTitle(QCoreApplication::translate("GestionCompteGUI", "Ajouter", nullptr));
     } // retranslateUi
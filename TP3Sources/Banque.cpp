@@ -0,0 +1,193 @@
+/**
+ * \file Banque.cpp
+ * \brief Implémentation de la classe Banque
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "Banque.h"
+#include "ContratException.h"
+
+using namespace std;
+namespace bancaire
+{
+/**
+ * \brief constructeur par défaut
+ * \post la banque ne contient aucun client
+ */
+Banque::Banque() : m_clients(FOLIO_MAX - FOLIO_MIN), m_nbrClients(0)
+{
+  POSTCONDITION (reqNbrClients() == 0);
+
+  INVARIANTS();
+}
+
+
+/**
+ * \brief constructeur de copie
+ *        Chaque client est copié en profondeur avec ses comptes.
+ * \param[in] p_banque la banque à copier
+ * \post la banque construite contient une copie indépendante des clients de p_banque
+ */
+Banque::Banque(const Banque& p_banque) : m_clients(FOLIO_MAX - FOLIO_MIN),
+                                         m_indexTelephone(p_banque.m_indexTelephone),
+                                         m_nbrClients(p_banque.m_nbrClients)
+{
+  for (size_t i = 0; i < p_banque.m_clients.size(); i++)
+    {
+      if (p_banque.m_clients[i])
+        {
+          m_clients[i] = std::make_unique<Client>(*p_banque.m_clients[i]);
+        }
+    }
+
+  POSTCONDITION (reqNbrClients() == p_banque.reqNbrClients());
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Opérateur de copie
+ * \param[in] p_banque la banque à copier
+ * \return une référence sur l'objet courant
+ * \post l'objet courant contient une copie indépendante des clients de p_banque
+ */
+Banque& Banque::operator=(const Banque& p_banque)
+{
+  if (this != &p_banque)
+    {
+      Banque copie(p_banque);
+      m_clients.swap(copie.m_clients);
+      m_indexTelephone.swap(copie.m_indexTelephone);
+      m_nbrClients = copie.m_nbrClients;
+    }
+
+  POSTCONDITION (reqNbrClients() == p_banque.reqNbrClients());
+  INVARIANTS();
+  return *this;
+}
+
+
+/**
+ * \brief Ajoute une copie d'un client à la banque
+ * \param[in] p_client le client à ajouter
+ * \pre aucun client de la banque n'a le folio de p_client
+ * \post le client est présent et indexé par son téléphone
+ */
+void Banque::ajouterClient(const Client& p_client)
+{
+  PRECONDITION (!estClientPresent(p_client.reqNoFolio()));
+
+  m_clients[p_client.reqNoFolio() - FOLIO_MIN] = std::make_unique<Client>(p_client);
+  m_indexTelephone.emplace(p_client.reqNoTelephone(), p_client.reqNoFolio());
+  m_nbrClients++;
+
+  POSTCONDITION (estClientPresent(p_client.reqNoFolio()));
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Supprime un client de la banque
+ * \param[in] p_noFolio le folio du client à supprimer
+ * \pre le client doit être présent
+ * \post le client n'est plus présent ni indexé
+ */
+void Banque::supprimerClient(unsigned p_noFolio)
+{
+  PRECONDITION (estClientPresent(p_noFolio));
+
+  auto intervalle = m_indexTelephone.equal_range(m_clients[p_noFolio - FOLIO_MIN]->reqNoTelephone());
+  for (auto iter = intervalle.first; iter != intervalle.second; ++iter)
+    {
+      if (iter->second == p_noFolio)
+        {
+          m_indexTelephone.erase(iter);
+          break;
+        }
+    }
+  m_clients[p_noFolio - FOLIO_MIN].reset();
+  m_nbrClients--;
+
+  POSTCONDITION (!estClientPresent(p_noFolio));
+  INVARIANTS();
+}
+
+
+/**
+ * \brief méthode accesseur retournant le nombre de clients
+ * \return le nombre de clients de la banque
+ */
+size_t Banque::reqNbrClients() const
+{
+  return m_nbrClients;
+}
+
+
+/**
+ * \brief Indique si un client occupe un folio
+ * \param[in] p_noFolio le folio à vérifier
+ * \return un booléen indiquant si un client de la banque a ce folio
+ */
+bool Banque::estClientPresent(unsigned p_noFolio) const
+{
+  return p_noFolio >= FOLIO_MIN && p_noFolio < FOLIO_MAX && m_clients[p_noFolio - FOLIO_MIN] != nullptr;
+}
+
+
+/**
+ * \brief méthode accesseur retournant le client d'un folio
+ * \param[in] p_noFolio le folio du client
+ * \return une référence constante sur le client
+ * \pre le client doit être présent
+ */
+const Client& Banque::reqClient(unsigned p_noFolio) const
+{
+  PRECONDITION (estClientPresent(p_noFolio));
+
+  return *m_clients[p_noFolio - FOLIO_MIN];
+}
+
+
+/**
+ * \brief méthode accesseur retournant le client d'un folio pour modification
+ * \param[in] p_noFolio le folio du client
+ * \return une référence sur le client
+ * \pre le client doit être présent
+ */
+Client& Banque::reqClient(unsigned p_noFolio)
+{
+  PRECONDITION (estClientPresent(p_noFolio));
+
+  return *m_clients[p_noFolio - FOLIO_MIN];
+}
+
+
+/**
+ * \brief Retrouve les clients ayant un numéro de téléphone
+ * \param[in] p_noTelephone le numéro normalisé, voir util::lireTelephone
+ * \return les clients ayant ce numéro, aucun s'il n'est pas indexé
+ */
+std::vector<const Client*> Banque::trouverParTelephone(std::uint64_t p_noTelephone) const
+{
+  std::vector<const Client*> clients;
+  auto intervalle = m_indexTelephone.equal_range(p_noTelephone);
+  for (auto iter = intervalle.first; iter != intervalle.second; ++iter)
+    {
+      clients.push_back(m_clients[iter->second - FOLIO_MIN].get());
+    }
+  return clients;
+}
+
+
+/**
+ * \brief Teste l'invariant de la classe Banque
+ */
+void Banque::verifieInvariant() const
+{
+  INVARIANT (m_clients.size() == FOLIO_MAX - FOLIO_MIN);
+  INVARIANT (m_indexTelephone.size() == m_nbrClients);
+}
+
+} // namespace bancaire
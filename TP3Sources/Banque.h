@@ -0,0 +1,63 @@
+/**
+ * \file Banque.h
+ * \brief Fichier qui contient l'interface de la classe Banque qui sert à la gestion de l'ensemble des clients.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef BANQUE_H
+#define BANQUE_H
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "Client.h"
+
+namespace bancaire
+{
+/**
+ * \class Banque
+ * \brief Classe servant à la gestion de l'ensemble des clients de la banque.
+ *
+ *              Les numéros de folio étant compris dans [1000, 10000[, chaque client
+ *              occupe la case de son folio dans un tableau, ce qui donne un accès
+ *              en temps constant par folio et un parcours naturel en ordre de folio.
+ *              Un index sur le téléphone normalisé permet de retrouver en temps
+ *              constant les clients partageant un numéro.
+ *              La classe n'accepte qu'un client par folio, c'est la responsabilité
+ *              de l'utilisateur de la classe de s'en assurer.
+ * \invariant Le nombre d'entrées de l'index téléphonique est égal au nombre de clients
+ */
+class Banque
+{
+public:
+  Banque();
+  Banque(const Banque& p_banque);
+  Banque& operator=(const Banque& p_banque);
+
+  void ajouterClient(const Client& p_client);
+  void supprimerClient(unsigned p_noFolio);
+
+  size_t reqNbrClients() const;
+  bool estClientPresent(unsigned p_noFolio) const;
+  const Client& reqClient(unsigned p_noFolio) const;
+  Client& reqClient(unsigned p_noFolio);
+  std::vector<const Client*> trouverParTelephone(std::uint64_t p_noTelephone) const;
+
+  static constexpr unsigned FOLIO_MIN = 1000;
+  static constexpr unsigned FOLIO_MAX = 10000;
+
+private:
+  std::vector<std::unique_ptr<Client>> m_clients;
+  std::unordered_multimap<std::uint64_t, unsigned> m_indexTelephone;
+  size_t m_nbrClients;
+
+  void verifieInvariant() const;
+};
+
+} // namespace bancaire
+
+#endif /* BANQUE_H */
@@ -0,0 +1,248 @@
+/**
+ * \file CalendrierOuvrable.cpp
+ * \brief Implémentation de la classe CalendrierOuvrable
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include <string>
+
+#include "CalendrierOuvrable.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+namespace util
+{
+
+namespace
+{
+const Date PREMIER_JOUR(1, 1, CalendrierOuvrable::ANNEE_MIN);
+const Date DERNIER_JOUR(31, 12, CalendrierOuvrable::ANNEE_MAX);
+const int NB_JOURS = (DERNIER_JOUR - PREMIER_JOUR) + 1;
+const int NB_MOTS = (NB_JOURS + 63) / 64;
+
+/**
+ * \brief Retourne le rang d'une date depuis le 1er janvier 1970
+ */
+int rangDe (const Date& p_date)
+{
+  return p_date - PREMIER_JOUR;
+}
+
+/**
+ * \brief Reconstruit la date correspondant à un rang depuis le 1er janvier 1970
+ *        (algorithme des jours civils, années débutant le 1er mars)
+ */
+Date dateDe (int p_rang)
+{
+  int z = p_rang + 719468;
+  int ere = z / 146097;
+  int jourEre = z - ere * 146097;
+  int anneeEre = (jourEre - jourEre / 1460 + jourEre / 36524 - jourEre / 146096) / 365;
+  int jourAnnee = jourEre - (365 * anneeEre + anneeEre / 4 - anneeEre / 100);
+  int moisDecale = (5 * jourAnnee + 2) / 153;
+  int jour = jourAnnee - (153 * moisDecale + 2) / 5 + 1;
+  int mois = moisDecale < 10 ? moisDecale + 3 : moisDecale - 9;
+  int annee = anneeEre + ere * 400 + (mois <= 2 ? 1 : 0);
+  return Date(jour, mois, annee);
+}
+} // namespace
+
+
+/**
+ * \brief constructeur par défaut
+ *        Tous les jours du lundi au vendredi sont ouvrables, aucun jour férié n'est chargé.
+ * \post les samedis et dimanches de l'intervalle ne sont pas ouvrables
+ */
+CalendrierOuvrable::CalendrierOuvrable() : m_ouvrables(NB_MOTS, 0), m_cumul(NB_MOTS, 0)
+{
+  // le 1er janvier 1970 est un jeudi: le rang 0 a l'indice 3 dans une semaine débutant le lundi
+  for (int rang = 0; rang < NB_JOURS; rang++)
+    {
+      if ((rang + 3) % 7 < 5)
+        {
+          m_ouvrables[rang / 64] |= std::uint64_t(1) << (rang % 64);
+        }
+    }
+  calculerCumul();
+
+  POSTCONDITION (!estJourOuvrable(Date(3, 1, 1970)));
+  POSTCONDITION (estJourOuvrable(Date(5, 1, 1970)));
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Ajoute un jour férié au calendrier
+ * \param[in] p_date le jour férié
+ * \pre p_date doit être dans l'intervalle 1970-2037
+ * \post p_date n'est pas un jour ouvrable
+ */
+void CalendrierOuvrable::ajouterJourFerie(const Date& p_date)
+{
+  PRECONDITION (estDansIntervalle(p_date));
+
+  int rang = rangDe(p_date);
+  std::uint64_t bit = std::uint64_t(1) << (rang % 64);
+  if (m_ouvrables[rang / 64] & bit)
+    {
+      m_ouvrables[rang / 64] &= ~bit;
+      for (size_t i = rang / 64 + 1; i < m_cumul.size(); i++)
+        {
+          m_cumul[i]--;
+        }
+    }
+
+  POSTCONDITION (!estJourOuvrable(p_date));
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Charge une liste de jours fériés, une date "JJ MM AAAA" par ligne
+ *        Les lignes vides sont ignorées, les dates valides sont chargées même si
+ *        d'autres lignes sont invalides.
+ * \param[in] p_is le flux d'entrée contenant les jours fériés
+ * \return un booléen indiquant si toutes les lignes non vides étaient des dates valides de l'intervalle
+ */
+bool CalendrierOuvrable::chargerJoursFeries(std::istream& p_is)
+{
+  bool valide = true;
+  string ligne;
+  Date date = PREMIER_JOUR;
+
+  while (getline(p_is, ligne))
+    {
+      if (!ligne.empty() && ligne.back() == '\r')
+        {
+          ligne.pop_back();
+        }
+      if (ligne.empty())
+        {
+          continue;
+        }
+      if (lireDate(ligne, date) && estDansIntervalle(date))
+        {
+          int rang = rangDe(date);
+          m_ouvrables[rang / 64] &= ~(std::uint64_t(1) << (rang % 64));
+        }
+      else
+        {
+          valide = false;
+        }
+    }
+  calculerCumul();
+
+  INVARIANTS();
+  return valide;
+}
+
+
+/**
+ * \brief Indique si une date est un jour ouvrable
+ * \param[in] p_date la date à vérifier
+ * \return un booléen indiquant si la date n'est ni une fin de semaine ni un jour férié
+ * \pre p_date doit être dans l'intervalle 1970-2037
+ */
+bool CalendrierOuvrable::estJourOuvrable(const Date& p_date) const
+{
+  PRECONDITION (estDansIntervalle(p_date));
+
+  int rang = rangDe(p_date);
+  return (m_ouvrables[rang / 64] >> (rang % 64)) & 1u;
+}
+
+
+/**
+ * \brief Retourne le premier jour ouvrable à partir d'une date (convention « jour suivant »)
+ * \param[in] p_date la date de valeur à rouler
+ * \return p_date si elle est ouvrable, sinon le premier jour ouvrable qui la suit
+ * \pre p_date doit être dans l'intervalle 1970-2037
+ * \post la date retournée est un jour ouvrable de l'intervalle
+ */
+Date CalendrierOuvrable::prochainJourOuvrable(const Date& p_date) const
+{
+  PRECONDITION (estDansIntervalle(p_date));
+
+  int rang = rangDe(p_date);
+  size_t mot = rang / 64;
+  std::uint64_t bits = m_ouvrables[mot] & (~std::uint64_t(0) << (rang % 64));
+  while (bits == 0 && ++mot < m_ouvrables.size())
+    {
+      bits = m_ouvrables[mot];
+    }
+  POSTCONDITION (bits != 0);
+
+  return dateDe(static_cast<int>(mot * 64) + __builtin_ctzll(bits));
+}
+
+
+/**
+ * \brief Compte les jours ouvrables entre deux dates
+ * \param[in] p_debut la date de début, incluse
+ * \param[in] p_fin la date de fin, exclue
+ * \return le nombre de jours ouvrables de l'intervalle [p_debut, p_fin[
+ * \pre p_debut et p_fin doivent être dans l'intervalle 1970-2037 et p_fin ne doit pas précéder p_debut
+ */
+int CalendrierOuvrable::nbJoursOuvrables(const Date& p_debut, const Date& p_fin) const
+{
+  PRECONDITION (estDansIntervalle(p_debut) && estDansIntervalle(p_fin));
+  PRECONDITION (!(p_fin < p_debut));
+
+  return nbOuvrablesAvant(rangDe(p_fin)) - nbOuvrablesAvant(rangDe(p_debut));
+}
+
+
+/**
+ * \brief Vérifie qu'une date est couverte par le calendrier
+ * \param[in] p_date la date à vérifier
+ * \return un booléen indiquant si l'année de la date est entre 1970 et 2037
+ */
+bool CalendrierOuvrable::estDansIntervalle(const Date& p_date)
+{
+  return p_date.reqAnnee() >= ANNEE_MIN && p_date.reqAnnee() <= ANNEE_MAX;
+}
+
+
+/**
+ * \brief Recalcule le cumul des jours ouvrables précédant chaque mot
+ */
+void CalendrierOuvrable::calculerCumul()
+{
+  std::uint32_t cumul = 0;
+  for (size_t i = 0; i < m_ouvrables.size(); i++)
+    {
+      m_cumul[i] = cumul;
+      cumul += __builtin_popcountll(m_ouvrables[i]);
+    }
+}
+
+
+/**
+ * \brief Retourne le nombre de jours ouvrables de rang strictement inférieur à p_rang
+ */
+int CalendrierOuvrable::nbOuvrablesAvant(int p_rang) const
+{
+  size_t mot = p_rang / 64;
+  int decalage = p_rang % 64;
+  int nombre = m_cumul[mot];
+  if (decalage != 0)
+    {
+      nombre += __builtin_popcountll(m_ouvrables[mot] & ((std::uint64_t(1) << decalage) - 1));
+    }
+  return nombre;
+}
+
+
+/**
+ * \brief Teste l'invariant de la classe CalendrierOuvrable
+ */
+void CalendrierOuvrable::verifieInvariant() const
+{
+  INVARIANT (m_ouvrables.size() == static_cast<size_t>(NB_MOTS));
+  INVARIANT (m_cumul.size() == m_ouvrables.size());
+}
+
+} // namespace util
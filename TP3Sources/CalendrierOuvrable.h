@@ -0,0 +1,61 @@
+/**
+ * \file CalendrierOuvrable.h
+ * \brief Fichier qui contient l'interface de la classe CalendrierOuvrable qui sert à déterminer les jours ouvrables.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef CALENDRIEROUVRABLE_H
+#define CALENDRIEROUVRABLE_H
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+#include "Date.h"
+
+namespace util
+{
+/**
+ * \class CalendrierOuvrable
+ * \brief Classe servant à déterminer les jours ouvrables entre 1970 et 2037.
+ *
+ *              Chaque jour de l'intervalle correspond à un bit, à 1 si le jour est ouvrable.
+ *              Les fins de semaine sont calculées une seule fois à la construction,
+ *              les jours fériés peuvent ensuite être ajoutés ou chargés d'un flux.
+ *              Un cumul des jours ouvrables par mot de 64 bits permet de compter
+ *              les jours ouvrables entre deux dates en temps constant.
+ *              La classe n'accepte que des dates dans l'intervalle, c'est la
+ *              responsabilité de l'utilisateur de la classe de s'en assurer.
+ * \invariant m_cumul[i] est le nombre de jours ouvrables avant le mot i de m_ouvrables
+ */
+class CalendrierOuvrable
+{
+public:
+  CalendrierOuvrable();
+
+  void ajouterJourFerie(const Date& p_date);
+  bool chargerJoursFeries(std::istream& p_is);
+
+  bool estJourOuvrable(const Date& p_date) const;
+  Date prochainJourOuvrable(const Date& p_date) const;
+  int nbJoursOuvrables(const Date& p_debut, const Date& p_fin) const;
+
+  static bool estDansIntervalle(const Date& p_date);
+
+  static const int ANNEE_MIN = 1970;
+  static const int ANNEE_MAX = 2037;
+
+private:
+  std::vector<std::uint64_t> m_ouvrables;
+  std::vector<std::uint32_t> m_cumul;
+
+  void calculerCumul();
+  int nbOuvrablesAvant(int p_rang) const;
+  void verifieInvariant() const;
+};
+
+} // namespace util
+
+#endif /* CALENDRIEROUVRABLE_H */
@@ -13,6 +13,7 @@
 
 #include "Cheque.h"
 #include "ContratException.h"
+#include "Instrumentation.h"
 
 using namespace std;
 namespace bancaire
@@ -46,6 +47,56 @@ Cheque::Cheque(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsign
 }
 
 
+/**
+ * \brief constructeur réservé à Cheque::creer, les attributs ayant déjà été validés
+ */
+Cheque::Cheque(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
+               double p_tauxInteretMinimum, const std::string& p_description, util::AttributsValides)
+                  : Compte(p_noCompte, p_tauxInteret, p_solde, p_description, util::Date(), util::AttributsValides()), 
+                    m_nombreTransactions(p_nombreTransactions), m_tauxInteretMinimum(p_tauxInteretMinimum)
+{
+  INVARIANTS();
+}
+
+
+/**
+ * \brief constructeur copie dont la description est allouée dans une ressource mémoire
+ * \param[in] p_cheque le compte cheque à copier
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la description
+ */
+Cheque::Cheque(const Cheque& p_cheque, std::pmr::memory_resource* p_ressource)
+                  : Compte(p_cheque, p_ressource), m_nombreTransactions(p_cheque.m_nombreTransactions), 
+                    m_tauxInteretMinimum(p_cheque.m_tauxInteretMinimum)
+{
+}
+
+
+/**
+ * \brief Fabrique un compte cheque sans lancer d'exception
+ *        Les attributs ne sont validés qu'une fois, ce qui convient aux chargements
+ *        en lot où les enregistrements invalides sont attendus.
+ * \param[in] p_noCompte est un entier positif qui représente le numéro du compte cheque
+ * \param[in] p_solde est un nombre décimale qui représente le solde du compte cheque
+ * \param[in] p_tauxInteret est un nombre décimale qui représente le taux d'intérêt du compte cheque
+ * \param[in] p_nombreTransactions est un entier positif qui représente le nombre de transactions du compte cheque
+ * \param[in] p_tauxInteretMinimum est un nombre décimale qui represésente le taux d'intérêt minimum du compte cheque
+ * \param[in] p_description est une chaîne de caractères qui représente la description du compte
+ * \return le compte cheque, ou std::nullopt si les attributs ne sont pas valides
+ */
+std::optional<Cheque> Cheque::creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
+                                    double p_tauxInteretMinimum, const std::string& p_description)
+{
+  if (!Compte::validerAttributs(p_noCompte, p_tauxInteret, p_description)
+      || !validerAttributsCheque(p_tauxInteretMinimum, p_nombreTransactions)
+      || !(p_tauxInteretMinimum < p_tauxInteret))
+    {
+      return std::nullopt;
+    }
+  return Cheque(p_noCompte, p_solde, p_tauxInteret, p_nombreTransactions, p_tauxInteretMinimum, 
+                p_description, util::AttributsValides());
+}
+
+
 /**
  * \brief méthode accesseur retournant le nombre de transactions 
  * \return un entier positif qui représente le nombre de transactions
@@ -128,6 +179,7 @@ Cheque::~Cheque()
  */
 double Cheque::calculerInteret() const
 {  
+  MESURER_LATENCE(CALCULER_INTERET);
   if (reqSolde() >= 0)
     {
       return 0.0;
@@ -186,4 +238,25 @@ std::unique_ptr<Compte> Cheque::clone() const
   return std::make_unique<Cheque>(*this);
 }
 
+
+/** 
+ * \brief Méthode virtuelle copiant l'objet courant dans une ressource mémoire, description comprise
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la copie
+ * \return la copie, à détruire par libererDans() avec la même ressource
+ */
+Compte* Cheque::clonerDans(std::pmr::memory_resource* p_ressource) const
+{
+  return copierDans(*this, p_ressource);
+}
+
+
+/** 
+ * \brief Méthode virtuelle détruisant un objet obtenu de clonerDans() et rendant sa mémoire
+ * \param[in] p_ressource la ressource passée à clonerDans()
+ */
+void Cheque::libererDans(std::pmr::memory_resource* p_ressource)
+{
+  libererCopie(this, p_ressource);
+}
+
 } // namespace bancaire
\ No newline at end of file
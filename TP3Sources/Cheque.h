@@ -11,6 +11,7 @@
 
 #include <string>
 #include <memory>
+#include <optional>
 
 #include "Date.h"
 #include "Compte.h"
@@ -36,6 +37,8 @@ class Cheque : public Compte
 public:
   Cheque(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
             double p_tauxInteretMinimum = 0.1, const std::string& p_description = "Cheque");
+  Cheque(const Cheque& p_cheque) = default;
+  Cheque(const Cheque& p_cheque, std::pmr::memory_resource* p_ressource);
 
   unsigned reqNbrTransactions() const;
   double reqTauxInteretMinimum() const;
@@ -47,10 +50,17 @@ public:
   virtual double calculerInteret() const;
   virtual std::string reqCompteFormate() const;
   virtual std::unique_ptr<Compte> clone() const override;
+  virtual Compte* clonerDans(std::pmr::memory_resource* p_ressource) const override;
+  virtual void libererDans(std::pmr::memory_resource* p_ressource) override;
   
   static bool validerAttributsCheque(double p_tauxInteretMinimum, unsigned p_nombreTransations); 
+  static std::optional<Cheque> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
+                                     double p_tauxInteretMinimum = 0.1, const std::string& p_description = "Cheque");
   
 private:
+  Cheque(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
+         double p_tauxInteretMinimum, const std::string& p_description, util::AttributsValides);
+
   unsigned m_nombreTransactions;
   double m_tauxInteretMinimum;
   
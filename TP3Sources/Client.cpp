@@ -9,11 +9,14 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <unordered_set>
 
 #include "Client.h"
 #include "validationFormat.h"
 #include "ContratException.h"
 #include "CompteException.h"
+#include "Instrumentation.h"
 
 
 using namespace std;
@@ -24,31 +27,88 @@ namespace bancaire
  * 		  On construit un objet Client à partir de valeurs passées en paramètres.
  * 		  Les attributs sont assignés seulement si l'objet est considéré comme valide.
  * 		  Autrement, une erreur de précondition est générée.
+ *                Le téléphone est lu une seule fois, directement dans m_noTelephone.
  * \param[in] p_noFolio est un entier positif qui représente le numéro de folio du client
  * \param[in] p_nom est une chaîne de caractères qui représente le nom du client
  * \param[in] p_prenom est une chaîne de caractères qui représente le prénom du client
  * \param[in] p_dateNaissance héritié de la classe date, reçoit trois entiers en paramètre représentant la date de naissance du client
  * \param[in] p_telephone est une chaîne de caractères qui représente le numéro de téléphone du client
+ * \param[in] p_ressource la ressource mémoire des comptes du client
  * \pre p_noFolio, p_nom, p_prenom, p_dateNaissance, p_telephone doivent correspondre à un client valide
+ * \pre p_ressource n'est pas nulle
  * \post L'objet construit a été initialisé à partir des attributs passés en paramètres
  */
 Client::Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, 
-               const util::Date& p_dateNaissance, const std::string& p_telephone) 
+               const util::Date& p_dateNaissance, const std::string& p_telephone, 
+               std::pmr::memory_resource* p_ressource) 
                : m_noFolio(p_noFolio), m_nom(p_nom), m_prenom(p_prenom), 
-                 m_dateNaissance(p_dateNaissance), m_telephone(p_telephone)
+                 m_dateNaissance(p_dateNaissance), m_telephone(p_telephone), m_noTelephone(0),
+                 m_vComptes(p_ressource)
 {
-  PRECONDITION (Client::validerAttributsClient(p_noFolio, p_nom, p_prenom, p_dateNaissance, p_telephone));
+  MESURER_LATENCE(CONSTRUCTION_CLIENT);
+  [[maybe_unused]] const util::ErreurNombre erreurTelephone = util::lireTelephone(p_telephone, m_noTelephone);
+  PRECONDITION (Client::validerIdentite(p_noFolio, p_nom, p_prenom, p_dateNaissance) 
+                && erreurTelephone == util::ErreurNombre::AUCUNE);
+  PRECONDITION (p_ressource != nullptr);
   
   POSTCONDITION (reqNoFolio() == p_noFolio);
-  POSTCONDITION (reqNom() == p_nom);
-  POSTCONDITION (reqPrenom() == p_prenom);
-  POSTCONDITION (reqDateNaissance() == p_dateNaissance.reqDateFormatee ());
-  POSTCONDITION (reqTelephone() == p_telephone);
+  POSTCONDITION (reqNomVue() == p_nom);
+  POSTCONDITION (reqPrenomVue() == p_prenom);
+  POSTCONDITION (reqDateNaissanceRef() == p_dateNaissance);
+  POSTCONDITION (reqTelephoneVue() == p_telephone);
+  POSTCONDITION (reqRessource() == p_ressource);
   
   INVARIANTS();
 }
 
 
+/** 
+ * \brief constructeur réservé à Client::creer, les attributs ayant déjà été validés
+ *        et le téléphone normalisé
+ * \param[in] p_noTelephone le téléphone normalisé, voir util::lireTelephone
+ * \param[in] p_ressource la ressource mémoire des comptes du client
+ */
+Client::Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, 
+               const util::Date& p_dateNaissance, const std::string& p_telephone, 
+               std::uint64_t p_noTelephone, std::pmr::memory_resource* p_ressource, util::AttributsValides) 
+               : m_noFolio(p_noFolio), m_nom(p_nom), m_prenom(p_prenom), 
+                 m_telephone(p_telephone), m_noTelephone(p_noTelephone), m_dateNaissance(p_dateNaissance),
+                 m_vComptes(p_ressource)
+{
+  INVARIANTS();
+}
+
+
+/** 
+ * \brief Fabrique un client sans lancer d'exception
+ *        Les attributs ne sont validés qu'une fois et le téléphone n'est lu
+ *        qu'une fois, ce qui convient aux chargements en lot.
+ * \param[in] p_noFolio est un entier positif qui représente le numéro de folio du client
+ * \param[in] p_nom est une chaîne de caractères qui représente le nom du client
+ * \param[in] p_prenom est une chaîne de caractères qui représente le prénom du client
+ * \param[in] p_dateNaissance représente la date de naissance du client
+ * \param[in] p_telephone est une chaîne de caractères qui représente le numéro de téléphone du client
+ * \param[in] p_ressource la ressource mémoire des comptes du client
+ * \return le client, ou std::nullopt si les attributs ne sont pas valides
+ * \pre p_ressource n'est pas nulle
+ */
+std::optional<Client> Client::creer(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, 
+                                    const util::Date& p_dateNaissance, const std::string& p_telephone,
+                                    std::pmr::memory_resource* p_ressource)
+{
+  PRECONDITION (p_ressource != nullptr);
+
+  std::uint64_t noTelephone;
+  if (!validerIdentite(p_noFolio, p_nom, p_prenom, p_dateNaissance)
+      || util::lireTelephone(p_telephone, noTelephone) != util::ErreurNombre::AUCUNE)
+    {
+      return std::nullopt;
+    }
+  return Client(p_noFolio, p_nom, p_prenom, p_dateNaissance, p_telephone, noTelephone, p_ressource, 
+                util::AttributsValides());
+}
+
+
 /** 
  * \brief constructeur de copie
  *                Forme canonique de coplien.
@@ -57,20 +117,42 @@ Client::Client(unsigned p_noFolio, const std::string& p_nom, const std::string&
  *                nouveau client de posséder sa propre copie des comptes.
  *                Cette copie est indépendante et ne modifie pas le comportement des comptes du client ultérieur. 
  *                
+ *                Comme pour les conteneurs std::pmr, la copie utilise la ressource mémoire
+ *                par défaut et non celle de p_client.
  * \param[in] p_client représente le client à copier
  * \post L'objet construit a été initialisé à partir de l'attribut passé en paramètre
  * \post m_vComptes contient une copie indépendante de p_client
  */
-Client::Client(const Client& p_client) : m_noFolio(p_client.m_noFolio), m_nom(p_client.m_nom), m_prenom(p_client.m_prenom), 
-                                         m_dateNaissance(p_client.m_dateNaissance), m_telephone(p_client.m_telephone)
+Client::Client(const Client& p_client) : Client(p_client, std::pmr::get_default_resource())
+{
+}
+
+
+/** 
+ * \brief constructeur de copie dans une ressource mémoire
+ *                Les comptes copiés, leurs descriptions et le vecteur qui les contient
+ *                sont alloués dans p_ressource.
+ * \param[in] p_client représente le client à copier
+ * \param[in] p_ressource la ressource mémoire des comptes de la copie
+ * \pre p_ressource n'est pas nulle
+ * \post L'objet construit a été initialisé à partir de l'attribut passé en paramètre
+ * \post m_vComptes contient une copie indépendante de p_client
+ */
+Client::Client(const Client& p_client, std::pmr::memory_resource* p_ressource) 
+               : m_noFolio(p_client.m_noFolio), m_nom(p_client.m_nom), m_prenom(p_client.m_prenom), 
+                 m_dateNaissance(p_client.m_dateNaissance), m_telephone(p_client.m_telephone), 
+                 m_noTelephone(p_client.m_noTelephone), m_vComptes(p_ressource)
 {  
+  PRECONDITION (p_ressource != nullptr);
+
+  m_vComptes.reserve(p_client.m_vComptes.size());
   for (auto& element: p_client.m_vComptes)
     {
-      m_vComptes.push_back(element-> clone());    
+      m_vComptes.push_back(copierCompte(*element));    
     }
   
-  POSTCONDITION (reqClientFormate() == p_client.reqClientFormate());
-  POSTCONDITION (reqReleves() == p_client.reqReleves ());
+  POSTCONDITION_AUDIT (reqClientFormate() == p_client.reqClientFormate());
+  POSTCONDITION_AUDIT (reqReleves() == p_client.reqReleves ());
   POSTCONDITION (reqNbrComptes() == p_client.reqNbrComptes());
   
   INVARIANTS();
@@ -100,22 +182,56 @@ Client& Client::operator=(const Client& p_client)
   m_prenom = p_client.m_prenom;
   m_dateNaissance = p_client.m_dateNaissance;
   m_telephone = p_client.m_telephone;
+  m_noTelephone = p_client.m_noTelephone;
     
   m_vComptes.clear();
+  m_vComptes.reserve(p_client.m_vComptes.size());
   for (auto& element : p_client.m_vComptes)
     {
-      m_vComptes.push_back(element-> clone());
+      m_vComptes.push_back(copierCompte(*element));
     }
-  return *this;
   
-  POSTCONDITION (reqClientFormate() == p_client.reqClientFormate());
-  POSTCONDITION (reqReleves() == p_client.reqReleves ());
+  POSTCONDITION_AUDIT (reqClientFormate() == p_client.reqClientFormate());
+  POSTCONDITION_AUDIT (reqReleves() == p_client.reqReleves ());
   POSTCONDITION (reqNbrComptes() == p_client.reqNbrComptes());
   
   INVARIANTS();
+  return *this;
 }
 
 
+/** 
+ * \brief Opérateur de déplacement
+ *                Les comptes de p_client sont repris sans copie si les deux clients ont la
+ *                même ressource mémoire. Sinon, ils sont copiés dans la ressource de l'objet
+ *                courant, comme par l'opérateur de copie: l'objet courant ne garde aucun
+ *                compte alloué dans la ressource de p_client, qui peut disparaître avant lui.
+ * \param[in] p_client représente le client à déplacer
+ * \return une référence sur l'objet courant
+ * \pre p_client doit être différent de l'objet courant
+ * \post L'objet courant a les attributs et les comptes de p_client et garde sa ressource mémoire
+ */
+Client& Client::operator=(Client&& p_client)
+{
+  PRECONDITION (!(this == &p_client));
+  
+  if (reqRessource() != p_client.reqRessource())
+    {
+      return *this = p_client;
+    }
+  
+  m_noFolio = p_client.m_noFolio;
+  m_nom = std::move(p_client.m_nom);
+  m_prenom = std::move(p_client.m_prenom);
+  m_dateNaissance = p_client.m_dateNaissance;
+  m_telephone = std::move(p_client.m_telephone);
+  m_noTelephone = p_client.m_noTelephone;
+  m_vComptes = std::move(p_client.m_vComptes);
+  
+  INVARIANTS();
+  return *this;
+}
+
 /** 
  * \brief méthode accesseur retournant le numéro de folio 
  * \return un entier positif qui représente le numéro de folio 
@@ -136,6 +252,16 @@ const std::string Client::reqTelephone() const
 }
 
 
+/** 
+ * \brief méthode accesseur retournant le numéro de téléphone normalisé
+ * \return les 10 chiffres du numéro de téléphone sous forme d'entier
+ */
+std::uint64_t Client::reqNoTelephone() const
+{
+  return m_noTelephone;
+}
+
+
 /** 
  * \brief méthode accesseur retournant le nom
  * \return une chaîne de caractères qui représente le nom
@@ -166,6 +292,56 @@ const std::string Client::reqDateNaissance() const
 }
 
 
+/** 
+ * \brief méthode accesseur retournant la date de naissance sans la formater
+ * \return une référence constante sur la date de naissance
+ */  
+const util::Date& Client::reqDateNaissanceRef() const
+{
+  return m_dateNaissance;
+}
+
+
+/** 
+ * \brief méthode accesseur retournant la ressource mémoire des comptes
+ * \return la ressource passée à la construction
+ */  
+std::pmr::memory_resource* Client::reqRessource() const
+{
+  return m_vComptes.get_allocator().resource();
+}
+
+
+/** 
+ * \brief méthode accesseur retournant le nom sans le copier
+ * \return une vue sur le nom, valide tant que le client existe et n'est pas modifié
+ */
+std::string_view Client::reqNomVue() const
+{
+  return m_nom;
+}
+
+
+/** 
+ * \brief méthode accesseur retournant le prénom sans le copier
+ * \return une vue sur le prénom, valide tant que le client existe et n'est pas modifié
+ */
+std::string_view Client::reqPrenomVue() const
+{
+  return m_prenom;
+}
+
+
+/** 
+ * \brief méthode accesseur retournant le numéro de téléphone saisi sans le copier
+ * \return une vue sur le numéro de téléphone, valide tant que le client existe et n'est pas modifié
+ */
+std::string_view Client::reqTelephoneVue() const
+{
+  return m_telephone;
+}
+
+
 /** 
  * \brief méthode accesseur retournant le nombre de comptes que le client possède
  * \return un nombre entier positif représentant le nombre de comptes
@@ -176,6 +352,20 @@ size_t Client::reqNbrComptes() const
 }
 
 
+/** 
+ * \brief méthode accesseur retournant un compte du client, dans l'ordre d'ajout
+ * \param[in] p_rang le rang du compte
+ * \return une référence constante sur le compte
+ * \pre p_rang doit être inférieur au nombre de comptes
+ */
+const Compte& Client::reqCompte(size_t p_rang) const
+{
+  PRECONDITION (p_rang < reqNbrComptes());
+
+  return *m_vComptes[p_rang];
+}
+
+
 /** 
  * \brief surcharge de l'opérateur <
  * \param[in] p_noFolio à comparer au numéro de folio courant 
@@ -195,17 +385,14 @@ bool Client::operator<(const Client& p_noFolio) const
  * \brief Méthode ajoutant un compte au vecteur de comptes
  * \param[in] p_nouveauCompte représente le nouveau compte à ajouter dans le vecteur 
  * \post L'objet construit a été initialisé à partir de l'attribut passé en paramètre
+ * \exception CompteDejaPresentException si le numéro de compte est déjà présent
  */
 void Client::ajouterCompte(const Compte& p_nouveauCompte)
 {
-    if (compteEstDejaPresent(p_nouveauCompte.reqNoCompte()))
+    if (essayerAjouterCompte(p_nouveauCompte) == ResultatCompte::COMPTE_DEJA_PRESENT)
     {
         throw CompteDejaPresentException(p_nouveauCompte.reqCompteFormate());
     }
-
-    m_vComptes.push_back(p_nouveauCompte.clone());
-    
-    INVARIANTS();
 }
 
 
@@ -213,23 +400,130 @@ void Client::ajouterCompte(const Compte& p_nouveauCompte)
  * \brief Méthode supprimant un compte de la liste de comptes
  * \param[in] p_noComte représente le compte à supprimer dans le vecteur 
  * \post L'objet passé en paramètre a été supprimé 
+ * \exception CompteAbsentException si le numéro de compte est absent
  */
 void Client::supprimerCompte(int p_noCompte)
 {
-    if (!compteEstDejaPresent(p_noCompte))
+    if (essayerSupprimerCompte(p_noCompte) == ResultatCompte::COMPTE_ABSENT)
     {
         throw CompteAbsentException("Le compte n'est pas présent dans la liste.");
     }
+}
+
 
+/**         
+ * \brief Méthode ajoutant un compte sans lancer d'exception
+ *        Un doublon est rapporté sans formater le compte ni allouer de mémoire,
+ *        ce qui convient aux traitements en lot où les doublons sont normaux.
+ * \param[in] p_nouveauCompte représente le nouveau compte à ajouter dans le vecteur 
+ * \return SUCCES si le compte a été ajouté, COMPTE_DEJA_PRESENT sinon
+ * \post en cas de succès, une copie du compte est présente
+ */
+ResultatCompte Client::essayerAjouterCompte(const Compte& p_nouveauCompte)
+{
+    MESURER_LATENCE(AJOUTER_COMPTE);
+    if (compteEstDejaPresent(p_nouveauCompte.reqNoCompte()))
+    {
+        return ResultatCompte::COMPTE_DEJA_PRESENT;
+    }
+
+    m_vComptes.push_back(copierCompte(p_nouveauCompte));
+    
+    INVARIANTS();
+    return ResultatCompte::SUCCES;
+}
+
+
+/**         
+ * \brief Méthode supprimant un compte sans lancer d'exception
+ * \param[in] p_noCompte représente le compte à supprimer dans le vecteur 
+ * \return SUCCES si le compte a été supprimé, COMPTE_ABSENT sinon
+ * \post en cas de succès, le compte n'est plus présent
+ */
+ResultatCompte Client::essayerSupprimerCompte(int p_noCompte)
+{
+    MESURER_LATENCE(SUPPRIMER_COMPTE);
     for (auto iter = m_vComptes.begin(); iter != m_vComptes.end(); ++iter)
     {
-        if ((*iter)->reqNoCompte() == p_noCompte)
+        if ((*iter)->reqNoCompte() == static_cast<unsigned>(p_noCompte))
         {
             m_vComptes.erase(iter);
             INVARIANTS();
-            return;
+            return ResultatCompte::SUCCES;
         }
     }
+    return ResultatCompte::COMPTE_ABSENT;
+}
+
+
+/**         
+ * \brief Méthode ajoutant un lot de comptes sans lancer d'exception
+ *        Les comptes sont déplacés sans copie si le client utilise le monceau, et
+ *        copiés dans sa ressource mémoire sinon. Les doublons, avec un compte
+ *        déjà présent ou à l'intérieur du lot, sont ignorés. La détection des
+ *        doublons se fait en une seule passe, ce qui évite le coût quadratique
+ *        d'appels répétés à essayerAjouterCompte lors d'un import volumineux.
+ * \param[in] p_nouveauxComptes les comptes à ajouter, en ordre d'ajout
+ * \return le nombre de comptes ajoutés
+ * \post p_nouveauxComptes est vide
+ */
+std::size_t Client::essayerAjouterComptes(std::vector<std::unique_ptr<Compte>>&& p_nouveauxComptes)
+{
+    std::unordered_set<unsigned> numeros;
+    numeros.reserve(m_vComptes.size() + p_nouveauxComptes.size());
+    for (const auto& element : m_vComptes)
+    {
+        numeros.insert(element->reqNoCompte());
+    }
+
+    std::size_t nbAjoutes = 0;
+    m_vComptes.reserve(m_vComptes.size() + p_nouveauxComptes.size());
+    for (auto& compte : p_nouveauxComptes)
+    {
+        if (compte && numeros.insert(compte->reqNoCompte()).second)
+        {
+            if (reqRessource() == std::pmr::new_delete_resource())
+            {
+                m_vComptes.push_back(PtrCompte(compte.release(), LiberateurCompte{nullptr}));
+            }
+            else
+            {
+                m_vComptes.push_back(copierCompte(*compte));
+            }
+            nbAjoutes++;
+        }
+    }
+    p_nouveauxComptes.clear();
+
+    POSTCONDITION (p_nouveauxComptes.empty());
+    INVARIANTS();
+    return nbAjoutes;
+}
+
+
+/**         
+ * \brief Méthode supprimant en une passe tous les comptes d'une plage de numéros
+ * \param[in] p_noPremier le plus petit numéro de compte à supprimer
+ * \param[in] p_noDernier le plus grand numéro de compte à supprimer
+ * \return le nombre de comptes supprimés
+ * \pre p_noPremier <= p_noDernier
+ * \post aucun compte de la plage n'est présent et l'ordre des autres comptes est conservé
+ */
+std::size_t Client::supprimerComptes(unsigned p_noPremier, unsigned p_noDernier)
+{
+    PRECONDITION (p_noPremier <= p_noDernier);
+
+    auto debutSupprimes = std::remove_if(m_vComptes.begin(), m_vComptes.end(),
+                                         [&] (const PtrCompte& p_compte)
+                                         {
+                                           return p_compte->reqNoCompte() >= p_noPremier
+                                                  && p_compte->reqNoCompte() <= p_noDernier;
+                                         });
+    std::size_t nbSupprimes = m_vComptes.end() - debutSupprimes;
+    m_vComptes.erase(debutSupprimes, m_vComptes.end());
+
+    INVARIANTS();
+    return nbSupprimes;
 }
 
 
@@ -240,10 +534,12 @@ void Client::supprimerCompte(int p_noCompte)
 std::string Client::reqClientFormate() const
 {
   ostringstream oss;
+  char date[util::Date::TAILLE_DATE_FORMATEE_MAX];
   
   oss << "Client no de folio : " << reqNoFolio() << endl;
-  oss << reqPrenom() << " " << reqNom() << endl;
-  oss << "Date de naissance : " << reqDateNaissance() << endl;
+  oss << reqPrenomVue() << " " << reqNomVue() << endl;
+  oss << "Date de naissance : ";
+  oss.write(date, reqDateNaissanceRef().ecrireDateFormatee(date) - date) << endl;
   oss << reqTelephoneFormate() << endl;
 
   return oss.str();
@@ -256,6 +552,7 @@ std::string Client::reqClientFormate() const
  */
 std::string Client::reqReleves() const
 {
+  MESURER_LATENCE(REQ_RELEVES);
   ostringstream oss;
   
   oss << reqClientFormate() ;
@@ -268,6 +565,22 @@ std::string Client::reqReleves() const
 }
 
 
+/** 
+ * \brief Ajoute les comptes epargne du client au lot d'un moteur d'intérêts
+ * \param[in] p_moteur le moteur qui calculera les intérêts courus de la période
+ */
+void Client::accumulerInterets(MoteurInteret& p_moteur) const
+{
+  for (const auto& element : m_vComptes)
+    {
+      if (const Epargne* epargne = dynamic_cast<const Epargne*>(element.get()))
+        {
+          p_moteur.ajouterCompte(*epargne);
+        }
+    }
+}
+
+
 /**     
  * \brief Vérifie la validité des attributs
  * \param[in] p_noFolio est un entier positif qui représente le numéro de folio du client
@@ -279,6 +592,23 @@ std::string Client::reqReleves() const
  */
 bool Client::validerAttributsClient(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom,
                                     const util::Date& p_dateNaissance, const std::string& p_telephone)
+{
+  std::uint64_t noTelephone;
+  return validerIdentite(p_noFolio, p_nom, p_prenom, p_dateNaissance) 
+         && util::lireTelephone(p_telephone, noTelephone) == util::ErreurNombre::AUCUNE;
+}
+
+
+/**     
+ * \brief Vérifie la validité des attributs du client autres que le téléphone
+ * \param[in] p_noFolio est un entier positif qui représente le numéro de folio du client
+ * \param[in] p_nom est une chaîne de caractères qui représente le nom du client
+ * \param[in] p_prenom est une chaîne de caractères qui représente le prénom du client
+ * \param[in] p_dateNaissance représente la date de naissance du client
+ * \return un booléen indiquant si les attributs sont valides ou non
+ */
+bool Client::validerIdentite(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom,
+                             const util::Date& p_dateNaissance)
 {
   bool valide = false;
   if (p_noFolio >= 1000 && p_noFolio < 10000)
@@ -289,21 +619,7 @@ bool Client::validerAttributsClient(unsigned p_noFolio, const std::string& p_nom
             {
               if (p_dateNaissance.reqAnnee() >= 1970 && p_dateNaissance.reqAnnee() <= 2037)
                 {        
-                  if (!p_telephone.empty())                 
-                    {
-                      std::string numerosTelephone;
-                      for (char c : p_telephone)
-                        {
-                          if (std::isdigit(c))
-                            {
-                              numerosTelephone += c;
-                            }
-                        }                     
-                      if (numerosTelephone.length() == 10)
-                        {                               
-                          valide = true;
-                        }                                
-                    }
+                  valide = true;
                 }
             }
         }
@@ -314,10 +630,12 @@ bool Client::validerAttributsClient(unsigned p_noFolio, const std::string& p_nom
 
 /** 
  * \brief Teste l'invariant de la classe Client. L'invariant de cette classe s'assure que la classe est valide
+ *        Le téléphone, normalisé à la construction, n'est pas revalidé à partir de la chaîne saisie.
  */
 void Client::verifieInvariant() const
 {
-  INVARIANT(Client::validerAttributsClient(m_noFolio, m_nom, m_prenom, m_dateNaissance, m_telephone));
+  INVARIANT(Client::validerIdentite(m_noFolio, m_nom, m_prenom, m_dateNaissance));
+  INVARIANT(m_noTelephone < 10000000000ULL);
 }
 
 
@@ -327,31 +645,66 @@ void Client::verifieInvariant() const
  */
 std::string Client::reqTelephoneFormate() const
 {
-  std::string numerosTelephone;
-  for (char c : m_telephone)
-    {
-      if (std::isdigit(c))
-      {
-        numerosTelephone += c;
-      }
-    }  
-  std::string numeroFormate;
-  numeroFormate.reserve(12);
-  for (int i = 0; i < numerosTelephone.length(); i++)
+  char tampon[TAILLE_TELEPHONE_FORMATE];
+  formaterTelephone(m_noTelephone, tampon);
+  return std::string(tampon, TAILLE_TELEPHONE_FORMATE);
+}
+
+
+/** 
+ * \brief Écrit un numéro de téléphone normalisé au format "000 000-0000" dans un tampon
+ * \param[in] p_noTelephone les 10 chiffres du numéro sous forme d'entier
+ * \param[out] p_tampon un tampon d'au moins TAILLE_TELEPHONE_FORMATE caractères, non terminé par '\0'
+ */
+void Client::formaterTelephone(std::uint64_t p_noTelephone, char* p_tampon)
+{
+  p_tampon[3] = ' ';
+  p_tampon[7] = '-';
+  for (int i = TAILLE_TELEPHONE_FORMATE - 1; i >= 0; i--)
     {
-      if (i == 3)
-        {
-          numeroFormate += ' ';
-        }
-      else if (i == 6)
+      if (i != 3 && i != 7)
         {
-          numeroFormate += '-';
+          p_tampon[i] = static_cast<char>('0' + p_noTelephone % 10);
+          p_noTelephone /= 10;
         }
-      numeroFormate += numerosTelephone[i];
     }
-  return numeroFormate;         
 }
 
+/**     
+ * \brief Copie un compte dans la ressource mémoire du client
+ *        Sur le monceau, la copie est faite par clone() comme avant l'ajout des
+ *        ressources, sans surcoût; sinon par Compte::clonerDans().
+ * \param[in] p_compte le compte à copier
+ * \return la copie, détruite avec le bon libérateur
+ */
+Client::PtrCompte Client::copierCompte(const Compte& p_compte) const
+{
+  std::pmr::memory_resource* ressource = reqRessource();
+  if (ressource == std::pmr::new_delete_resource())
+    {
+      return PtrCompte(p_compte.clone().release(), LiberateurCompte{nullptr});
+    }
+  return PtrCompte(p_compte.clonerDans(ressource), LiberateurCompte{ressource});
+}
+
+
+/**     
+ * \brief Détruit un compte du client et rend sa mémoire là où elle a été prise
+ * \param[in] p_compte le compte à détruire
+ */
+void Client::LiberateurCompte::operator()(Compte* p_compte) const
+{
+  if (m_ressource == nullptr)
+    {
+      delete p_compte;
+    }
+  else
+    {
+      p_compte->libererDans(m_ressource);
+    }
+}
+
+
 /**     
  * \brief Vérifie si le numéro de compte existe déjà
  * \param[in] p_noCompte est un entier positif représentant le numéro de compte du client
@@ -10,16 +10,32 @@
 #define CLIENT_H
 
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
 #include <vector>
+#include <optional>
+#include <cstdint>
 
 #include "Date.h"
 #include "Compte.h"
 #include "Epargne.h"
 #include "Cheque.h"
+#include "MoteurInteret.h"
 
 namespace bancaire
 {
+/**
+ * \brief Résultat des opérations non lançantes sur les comptes d'un client
+ */
+enum class ResultatCompte
+{
+  SUCCES,
+  COMPTE_DEJA_PRESENT,
+  COMPTE_ABSENT
+};
+
+
 /**
  * \class Client
  * \brief Classe sert à la gestion des comptes du client.
@@ -34,6 +50,13 @@ namespace bancaire
  *              le cas d'allocations dynamiques.
  *              La classe n'accepte que des clients valides, c'est la responsabilité
  *              de l'utilisateur de la classe de s'en asssurer.             
+ *              Les comptes, leurs descriptions et le vecteur qui les contient sont alloués
+ *              dans une ressource mémoire std::pmr, par défaut celle du programme. Avec une
+ *              ressource commune à plusieurs clients, par exemple un
+ *              std::pmr::monotonic_buffer_resource, les comptes sont contigus, la copie d'un
+ *              client n'est qu'une suite d'avances de pointeur et la mémoire de tous les
+ *              comptes est rendue d'un coup par la ressource. La ressource doit survivre au
+ *              client et à tout client qui en a reçu les comptes par déplacement.
  * \invariant La validité peut être vérifiée avec la méthode static 
  *              bool validerAttributsClient(noFolio, nom, prenom, dateNaissance, telephone)
  * 
@@ -41,37 +64,76 @@ namespace bancaire
 class Client
 {
 public:
-  Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone); 
+  Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone,
+         std::pmr::memory_resource* p_ressource = std::pmr::get_default_resource()); 
   Client(const Client& p_client);       
+  Client(const Client& p_client, std::pmr::memory_resource* p_ressource);
+  Client(Client&& p_client) = default;
   Client& operator=(const Client& p_client);  
+  Client& operator=(Client&& p_client);
   
   unsigned reqNoFolio() const;
   const std::string reqTelephone() const;   
+  std::uint64_t reqNoTelephone() const;
   const std::string reqNom() const;
   const std::string reqPrenom() const;
   const std::string reqDateNaissance() const;
+  const util::Date& reqDateNaissanceRef() const;
+  std::pmr::memory_resource* reqRessource() const;
+  std::string_view reqNomVue() const;
+  std::string_view reqPrenomVue() const;
+  std::string_view reqTelephoneVue() const;
   
-  size_t reqNbrComptes() const;                                       
+  size_t reqNbrComptes() const;
+  const Compte& reqCompte(size_t p_rang) const;                                       
   
   bool operator<(const Client& p_noFolio) const; 
 
   void ajouterCompte (const Compte& p_nouveauCompte);
   void supprimerCompte (int p_noCompte);
+  ResultatCompte essayerAjouterCompte (const Compte& p_nouveauCompte);
+  ResultatCompte essayerSupprimerCompte (int p_noCompte);
+  std::size_t essayerAjouterComptes (std::vector<std::unique_ptr<Compte>>&& p_nouveauxComptes);
+  std::size_t supprimerComptes (unsigned p_noPremier, unsigned p_noDernier);
   std::string reqClientFormate() const;
   std::string reqReleves() const;
+  void accumulerInterets (MoteurInteret& p_moteur) const;
 
   static bool validerAttributsClient(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone);
+  static std::optional<Client> creer(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone,
+                                     std::pmr::memory_resource* p_ressource = std::pmr::get_default_resource());
   std::string reqTelephoneFormate() const;
+  static void formaterTelephone(std::uint64_t p_noTelephone, char* p_tampon);
+  
+  static const std::size_t TAILLE_TELEPHONE_FORMATE = 12;
   
 private:
+  /**
+   * \brief Détruit un compte du client: sur le monceau si m_ressource est nul, par
+   *        Compte::libererDans() sinon
+   */
+  struct LiberateurCompte
+  {
+    std::pmr::memory_resource* m_ressource;
+    void operator()(Compte* p_compte) const;
+  };
+  typedef std::unique_ptr<Compte, LiberateurCompte> PtrCompte;
+
+  Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, 
+         const std::string& p_telephone, std::uint64_t p_noTelephone, std::pmr::memory_resource* p_ressource, 
+         util::AttributsValides);
+
   unsigned m_noFolio; 
   std::string m_nom;    
   std::string m_prenom; 
   std::string m_telephone;  
+  std::uint64_t m_noTelephone;
   util::Date m_dateNaissance;
-  std::vector<std::unique_ptr<Compte>> m_vComptes; 
+  std::pmr::vector<PtrCompte> m_vComptes; 
   
+  PtrCompte copierCompte(const Compte& p_compte) const;
   bool compteEstDejaPresent(int p_noCompte) const;
+  static bool validerIdentite(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance);
   void verifieInvariant() const; 
 };
 
@@ -39,13 +39,45 @@ Compte::Compte(unsigned p_noCompte, double p_tauxInteret, double p_solde,
   POSTCONDITION (reqNoCompte() == p_noCompte);
   POSTCONDITION (reqTauxInteret() == p_tauxInteret);
   POSTCONDITION (reqSolde() == p_solde);
-  POSTCONDITION (reqDescription() == p_description);
-  POSTCONDITION (reqDateOuverture() == p_dateOuverture.reqDateFormatee());
+  POSTCONDITION (reqDescriptionVue() == p_description);
+  POSTCONDITION (reqDateOuvertureRef() == p_dateOuverture);
   
   INVARIANTS();
 }
 
 
+/**
+ * \brief constructeur réservé aux fabriques creer() des classes dérivées,
+ *        les attributs ayant déjà été validés
+ * \param[in] p_noCompte est un entier positif qui représente le numéro du compte
+ * \param[in] p_tauxInteret est un nombre décimale qui représente le taux d'intérêt du compte
+ * \param[in] p_solde est un nombre décimale qui représente le solde du compte
+ * \param[in] p_description est une chaîne de caractères qui représente la description du compte
+ * \param[in] p_dateOuverture représente la date d'ouverture du compte
+ */
+Compte::Compte(unsigned p_noCompte, double p_tauxInteret, double p_solde, 
+               const std::string& p_description, const util::Date& p_dateOuverture, util::AttributsValides)
+                    : m_noCompte(p_noCompte), m_tauxInteret(p_tauxInteret), m_solde(p_solde), 
+                      m_description(p_description), m_dateOuverture(p_dateOuverture)
+{
+  INVARIANTS();
+}
+
+
+/**
+ * \brief constructeur copie dont la description est allouée dans une ressource mémoire
+ * \param[in] p_compte le compte à copier
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la description
+ * \post L'objet construit a les mêmes attributs que p_compte
+ */
+Compte::Compte(const Compte& p_compte, std::pmr::memory_resource* p_ressource)
+                    : m_noCompte(p_compte.m_noCompte), m_tauxInteret(p_compte.m_tauxInteret), 
+                      m_solde(p_compte.m_solde), m_description(p_compte.m_description, p_ressource), 
+                      m_dateOuverture(p_compte.m_dateOuverture)
+{
+}
+
+
 /**
  * \brief méthode accesseur retournant le numéro du compte
  * \return un entier positif qui représente le numéro du compte
@@ -82,7 +114,7 @@ double Compte::reqSolde () const
  */
 const string Compte::reqDescription() const
 {
-  return m_description;
+  return string(m_description.data(), m_description.size());
 }
 
 
@@ -96,6 +128,26 @@ const string Compte::reqDateOuverture() const
 }
 
 
+/** 
+ * \brief méthode accesseur retournant la date d'ouverture du compte sans la formater
+ * \return une référence constante sur la date d'ouverture du compte
+ */
+const util::Date& Compte::reqDateOuvertureRef() const
+{
+  return m_dateOuverture;
+}
+
+
+/** 
+ * \brief méthode accesseur retournant la description du compte sans la copier
+ * \return une vue sur la description, valide tant que le compte existe et n'est pas modifié
+ */
+std::string_view Compte::reqDescriptionVue() const
+{
+  return m_description;
+}
+
+
 /** 
  * \brief Assigne un taux d'intérêt à l'objet courant
  * \param[in] p_tauxInteret est un nombre décimale qui représente le taux d'intérêt du compte
@@ -142,7 +194,7 @@ void Compte::asgDescription(const std::string& p_description)
   
   m_description = p_description;  
   
-  POSTCONDITION (m_description == p_description);
+  POSTCONDITION (reqDescriptionVue() == p_description);
   INVARIANTS();
 }
 
@@ -154,7 +206,7 @@ void Compte::asgDescription(const std::string& p_description)
  * \param[in] p_description est une chaîne de caractères qui représente la description du compte
  * \return un booléen indiquant si les attributs sont valides ou non
  */
-bool Compte::validerAttributs(unsigned p_noCompte, double p_tauxInteret, const std::string& p_description)
+bool Compte::validerAttributs(unsigned p_noCompte, double p_tauxInteret, std::string_view p_description)
 {
   bool valide = false;
   if (p_noCompte > 0)
@@ -189,6 +241,30 @@ Compte::~Compte()
 }
 
 
+/**
+ * \brief Méthode virtuelle copiant l'objet courant dans une ressource mémoire, description comprise
+ *        Les classes dérivées redéfinissent clonerDans() et libererDans() ensemble, avec
+ *        copierDans() et libererCopie(); sans redéfinition, la copie est faite sur le
+ *        monceau par clone() et la ressource n'est pas utilisée.
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la copie
+ * \return la copie, à détruire par son propre libererDans() avec la même ressource
+ */
+Compte* Compte::clonerDans([[maybe_unused]] std::pmr::memory_resource* p_ressource) const
+{
+  return clone().release();
+}
+
+
+/**
+ * \brief Méthode virtuelle détruisant un objet obtenu de clonerDans() et rendant sa mémoire
+ * \param[in] p_ressource la ressource passée à clonerDans()
+ */
+void Compte::libererDans([[maybe_unused]] std::pmr::memory_resource* p_ressource)
+{
+  delete this;
+}
+
+
 /**
  * \brief Méthode calculant le taux d'intérêt du compte
  * \return un nombre décimal 
@@ -206,10 +282,12 @@ double Compte::calculerInteret() const
 std::string Compte::reqCompteFormate() const
 {
   ostringstream oss;
+  char date[util::Date::TAILLE_DATE_FORMATEE_MAX];
    
   oss << "Numero : " << reqNoCompte() << endl;
-  oss << "Description : " << reqDescription() << endl;
-  oss << "Date d'ouverture : " << reqDateOuverture() << endl;
+  oss << "Description : " << reqDescriptionVue() << endl;
+  oss << "Date d'ouverture : ";
+  oss.write(date, reqDateOuvertureRef().ecrireDateFormatee(date) - date) << endl;
   oss << "Taux d'intérêt : " << std::setprecision(3) << reqTauxInteret() << endl;
   oss << "Solde : " << std::fixed << setprecision(0) << reqSolde() << "$" << endl;
    
@@ -10,7 +10,10 @@
 #define COMPTE_H
 
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
+#include <new>
 
 #include "Date.h"
 
@@ -35,6 +38,9 @@ class Compte
 {
 public:
   Compte(unsigned p_noCompte, double p_tauxInteret, double p_solde, const std::string& p_description, const util::Date& p_dateOuverture);
+  Compte(const Compte& p_compte) = default;
+  Compte(const Compte& p_compte, std::pmr::memory_resource* p_ressource);
+  Compte& operator=(const Compte& p_compte) = default;
   
   unsigned reqNoCompte () const;
   double reqTauxInteret() const;
@@ -42,6 +48,8 @@ public:
   
   const std::string reqDescription() const;
   const std::string reqDateOuverture() const;
+  const util::Date& reqDateOuvertureRef() const;
+  std::string_view reqDescriptionVue() const;
   
   void asgTauxInteret(double p_tauxInteret);
   void asgSolde(double p_solde);
@@ -50,16 +58,53 @@ public:
   virtual ~Compte(); 
   
   virtual std::unique_ptr<Compte> clone() const=0; 
+  virtual Compte* clonerDans(std::pmr::memory_resource* p_ressource) const;
+  virtual void libererDans(std::pmr::memory_resource* p_ressource);
   virtual double calculerInteret() const; 
   virtual std::string reqCompteFormate() const; 
   
-  static bool validerAttributs(unsigned p_noCompte, double p_tauxInteret, const std::string& p_description); 
+  static bool validerAttributs(unsigned p_noCompte, double p_tauxInteret, std::string_view p_description); 
    
+protected:
+  Compte(unsigned p_noCompte, double p_tauxInteret, double p_solde, const std::string& p_description, 
+         const util::Date& p_dateOuverture, util::AttributsValides);
+
+  /**
+   * \brief Construit une copie d'un compte dans une ressource mémoire, pour clonerDans()
+   * \param[in] p_modele le compte à copier, de type exact T
+   * \param[in] p_ressource la ressource qui fournit l'objet et sa description
+   * \return la copie, à libérer avec libererCopie()
+   */
+  template <typename T>
+  static T* copierDans (const T& p_modele, std::pmr::memory_resource* p_ressource)
+  {
+    void* bloc = p_ressource->allocate(sizeof(T), alignof(T));
+    try
+      {
+        return ::new (bloc) T(p_modele, p_ressource);
+      }
+    catch (...)
+      {
+        p_ressource->deallocate(bloc, sizeof(T), alignof(T));
+        throw;
+      }
+  }
+
+  /**
+   * \brief Détruit une copie faite par copierDans() et rend sa mémoire à la ressource, pour libererDans()
+   */
+  template <typename T>
+  static void libererCopie (T* p_compte, std::pmr::memory_resource* p_ressource)
+  {
+    p_compte->~T();
+    p_ressource->deallocate(p_compte, sizeof(T), alignof(T));
+  }
+
 private:
   unsigned m_noCompte;
   double m_tauxInteret;
   double m_solde;
-  std::string m_description;
+  std::pmr::string m_description;
   util::Date m_dateOuverture; 
   
   void verifieInvariant() const;  
@@ -89,3 +89,75 @@ PostconditionException::PostconditionException (const std::string& p_fichier, un
 InvariantException::InvariantException (const std::string& p_fichier, unsigned int p_ligne,
                                         const std::string& p_expression)
 : ContratException (p_fichier, p_ligne, p_expression, "ERREUR D'INVARIANT") { }
+
+
+/**
+ * \brief Assigne la période d'échantillonnage des invariants
+ * \param p_periode un invariant est vérifié une fois sur p_periode appels, 0 pour désactiver
+ */
+void EchantillonnageInvariants::asgPeriode (unsigned p_periode)
+{
+  s_periode.store (p_periode, memory_order_relaxed);
+}
+
+
+/**
+ * \brief Accesseur de la période d'échantillonnage des invariants
+ * \return la période, 0 si la vérification est désactivée
+ */
+unsigned EchantillonnageInvariants::reqPeriode ()
+{
+  return s_periode.load (memory_order_relaxed);
+}
+
+
+/**
+ * \brief Accesseur du nombre d'invariants vérifiés depuis la dernière réinitialisation
+ * \return le nombre de vérifications, tous fils d'exécution confondus
+ */
+std::uint64_t EchantillonnageInvariants::reqNbVerifications ()
+{
+  return s_nbVerifications.load (memory_order_relaxed);
+}
+
+
+/**
+ * \brief Accesseur du nombre de violations comptées depuis la dernière réinitialisation
+ * \return le nombre de violations, tous fils d'exécution confondus
+ */
+std::uint64_t EchantillonnageInvariants::reqNbViolations ()
+{
+  return s_nbViolations.load (memory_order_relaxed);
+}
+
+
+/**
+ * \brief Accesseur de l'expression de la dernière violation comptée
+ * \return le test logique qui a échoué, nullptr si aucune violation
+ */
+const char* EchantillonnageInvariants::reqDerniereViolation ()
+{
+  return s_derniereViolation.load (memory_order_relaxed);
+}
+
+
+/**
+ * \brief Remet les compteurs de vérifications et de violations à zéro
+ */
+void EchantillonnageInvariants::reinitialiserCompteurs ()
+{
+  s_nbVerifications.store (0, memory_order_relaxed);
+  s_nbViolations.store (0, memory_order_relaxed);
+  s_derniereViolation.store (nullptr, memory_order_relaxed);
+}
+
+
+/**
+ * \brief Compte une violation d'invariant
+ * \param p_expression Test logique qui a échoué, une chaîne littérale
+ */
+void EchantillonnageInvariants::signalerViolation (const char* p_expression)
+{
+  s_nbViolations.fetch_add (1, memory_order_relaxed);
+  s_derniereViolation.store (p_expression, memory_order_relaxed);
+}
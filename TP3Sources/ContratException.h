@@ -7,7 +7,8 @@
  * la sauvegarde des renseignements de l'erreur.  Cette classe et sa
  * hiérarchie sont intéressantes lors de l'utilisation des exceptions.
  *
- * En release, définir la constante NDEBUG pour désactiver les Macros
+ * En release, définir la constante NDEBUG pour désactiver les Macros, ou choisir
+ * un niveau de vérification avec CONTRAT_NIVEAU (voir plus bas)
  *
  * <pre>
  * Classes:
@@ -37,6 +38,8 @@
 
 #include <string>
 #include <stdexcept>
+#include <atomic>
+#include <cstdint>
 
 /**
  * \class ContratException
@@ -105,10 +108,86 @@ public:
 };
 
 
-// --- Définition des macros de contrôle de la théorie du contrat
+/**
+ * \class EchantillonnageInvariants
+ * \brief Vérification par échantillonnage des invariants et compteurs associés.
+ *
+ *        Lorsque CONTRAT_ECHANTILLONNAGE est défini, INVARIANTS() n'appelle
+ *        verifieInvariant() qu'une fois sur N appels, par fil d'exécution.
+ *        Au niveau CONTRAT_NIVEAU_AUCUN, une violation est comptée au lieu de
+ *        lancer une InvariantException, ce qui garde une visibilité sur la
+ *        corruption des données en production sans l'interrompre.
+ *        Une période de 0 désactive la vérification.
+ */
+class EchantillonnageInvariants
+{
+public:
+  static const unsigned PERIODE_DEFAUT = 1000;
+
+  static void asgPeriode (unsigned p_periode);
+  static unsigned reqPeriode ();
+  static std::uint64_t reqNbVerifications ();
+  static std::uint64_t reqNbViolations ();
+  static const char* reqDerniereViolation ();
+  static void reinitialiserCompteurs ();
+  static void signalerViolation (const char* p_expression);
+
+  /**
+   * \brief Indique si l'appel courant de INVARIANTS() doit vérifier l'invariant
+   * \return vrai une fois sur reqPeriode() appels du fil d'exécution courant
+   */
+  static bool doitVerifier ()
+  {
+    unsigned periode = s_periode.load (std::memory_order_relaxed);
+    if (periode == 0 || ++t_nbAppels < periode)
+      {
+        return false;
+      }
+    t_nbAppels = 0;
+    s_nbVerifications.fetch_add (1, std::memory_order_relaxed);
+    return true;
+  }
+
+private:
+  static inline std::atomic<unsigned> s_periode {PERIODE_DEFAUT};
+  static inline std::atomic<std::uint64_t> s_nbVerifications {0};
+  static inline std::atomic<std::uint64_t> s_nbViolations {0};
+  static inline std::atomic<const char*> s_derniereViolation {nullptr};
+  static inline thread_local unsigned t_nbAppels = 0;
+};
 
+
+// --- Niveaux de vérification de la théorie du contrat
+//
+// CONTRAT_NIVEAU_AUCUN:  aucune vérification
+// CONTRAT_NIVEAU_DEFAUT: vérifications peu coûteuses, en temps constant, sans
+//                        allocation (PRECONDITION, POSTCONDITION, INVARIANT, ASSERTION)
+// CONTRAT_NIVEAU_AUDIT:  s'ajoutent les vérifications coûteuses (formatage, copies,
+//                        parcours complets: PRECONDITION_AUDIT, POSTCONDITION_AUDIT, ...)
+//
+// Le niveau se choisit par unité de compilation en définissant CONTRAT_NIVEAU
+// avant toute inclusion, par exemple -DCONTRAT_NIVEAU=CONTRAT_NIVEAU_DEFAUT.
+// Sans définition, le niveau est AUDIT en debug et AUCUN si NDEBUG est défini.
+//
+// Définir aussi CONTRAT_ECHANTILLONNAGE pour ne vérifier les invariants qu'une
+// fois sur N appels de INVARIANTS(), voir EchantillonnageInvariants.
+
+#define CONTRAT_NIVEAU_AUCUN  0
+#define CONTRAT_NIVEAU_DEFAUT 1
+#define CONTRAT_NIVEAU_AUDIT  2
+
+#if !defined(CONTRAT_NIVEAU)
 #if !defined(NDEBUG)
-// --- Mode debug
+#define CONTRAT_NIVEAU CONTRAT_NIVEAU_AUDIT
+#else
+#define CONTRAT_NIVEAU CONTRAT_NIVEAU_AUCUN
+#endif
+#endif
+
+// --- Définition des macros de contrôle de la théorie du contrat
+
+#if CONTRAT_NIVEAU >= CONTRAT_NIVEAU_DEFAUT
+// --- Niveau par défaut
 
 #define INVARIANTS() \
       verifieInvariant()
@@ -122,7 +201,7 @@ public:
 #define INVARIANT(f)   \
       if (!(f)) throw InvariantException(__FILE__,__LINE__, #f);
 
-// --- LE MODE RELEASE
+// --- Aucune vérification
 #else
 
 #define PRECONDITION(f);
@@ -131,6 +210,46 @@ public:
 #define INVARIANT(f);
 #define ASSERTION(f);
 
-#endif  // --- if !defined (NDEBUG)
+#endif  // --- if CONTRAT_NIVEAU >= CONTRAT_NIVEAU_DEFAUT
+
+#if CONTRAT_NIVEAU >= CONTRAT_NIVEAU_AUDIT
+// --- Niveau audit
+
+#define ASSERTION_AUDIT(f)     ASSERTION(f)
+#define PRECONDITION_AUDIT(f)  PRECONDITION(f)
+#define POSTCONDITION_AUDIT(f) POSTCONDITION(f)
+#define INVARIANT_AUDIT(f)     INVARIANT(f)
+
+#else
+
+#define ASSERTION_AUDIT(f);
+#define PRECONDITION_AUDIT(f);
+#define POSTCONDITION_AUDIT(f);
+#define INVARIANT_AUDIT(f);
+
+#endif  // --- if CONTRAT_NIVEAU >= CONTRAT_NIVEAU_AUDIT
+
+// --- Échantillonnage des invariants
+//
+// INVARIANTS() n'appelle verifieInvariant() qu'une fois sur N, quel que soit le niveau.
+// Seul le niveau AUCUN compte une violation sans l'interrompre; aux niveaux DEFAUT et
+// AUDIT, un INVARIANT échantillonné qui échoue lance toujours une InvariantException et
+// n'est pas compté dans reqNbViolations(). La configuration Echantillonnage compile la
+// bibliothèque au niveau AUCUN avec CONTRAT_ECHANTILLONNAGE.
+
+#if defined(CONTRAT_ECHANTILLONNAGE)
+
+#undef INVARIANTS
+#define INVARIANTS() \
+      if (::EchantillonnageInvariants::doitVerifier ()) verifieInvariant()
+
+#if CONTRAT_NIVEAU < CONTRAT_NIVEAU_DEFAUT
+#undef INVARIANT
+#define INVARIANT(f)   \
+      if (!(f)) ::EchantillonnageInvariants::signalerViolation(#f);
+#endif
+
+#endif  // --- if defined(CONTRAT_ECHANTILLONNAGE)
+
 #endif  // --- ifndef CONTRATEXCEPTION_H_DEJA_INCLU
 
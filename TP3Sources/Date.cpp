@@ -7,6 +7,9 @@
 #include "ContratException.h"
 #include "Date.h"
 #include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <ctime>
 #include <chrono>
 #include <iostream>
@@ -54,6 +57,17 @@ namespace util
     INVARIANTS ();
   }
 
+  /**
+   * \brief constructeur réservé à Date::creer, la date ayant déjà été validée
+   * \param[in] p_jour est un entier qui représente le jour de la date
+   * \param[in] p_mois est un entier qui représente le mois de la date
+   * \param[in] p_annee est un entier qui représente l'année de la date
+   */
+  Date::Date (int p_jour, int p_mois, int p_annee, AttributsValides) : m_jour (p_jour), m_mois (p_mois), m_annee (p_annee)
+  {
+    INVARIANTS ();
+  }
+
   /**
    * \brief Assigne une date à l'objet courant
    * \param[in] p_jour est un entier qui représente le jour de la date
@@ -211,10 +225,10 @@ namespace util
    * utilise l'algorithme de Zeller (ou congruence de Zeller)
    * \return une chaîne de caractères qui représente le nom du jour de la semaine en français
    */
-  string
+  const char*
   Date::reqNomJourSemaine () const
   {
-    static string JourSemaine[] = {"Samedi", "Dimanche", "Lundi", "Mardi", "Mercredi", "Jeudi", "Vendredi"};
+    static const char* const JourSemaine[] = {"Samedi", "Dimanche", "Lundi", "Mardi", "Mercredi", "Jeudi", "Vendredi"};
 
     int mois = m_mois;
     int y = m_annee;
@@ -235,10 +249,10 @@ namespace util
    * \brief retourne le nom du mois en français
    * \return une chaîne de caractères qui représente le nom du mois en français
    */
-  string
+  const char*
   Date::reqNomMois () const
   {
-    static string NomMois[] = {"janvier", "fevrier", "mars", "avril", "mai", "juin", "juillet", "aout",
+    static const char* const NomMois[] = {"janvier", "fevrier", "mars", "avril", "mai", "juin", "juillet", "aout",
       "septembre", "octobre", "novembre", "decembre"};
 
     return NomMois[m_mois - 1];
@@ -251,18 +265,35 @@ namespace util
   string
   Date::reqDateFormatee () const
   {
-    ostringstream os;
+    char tampon[TAILLE_DATE_FORMATEE_MAX];
 
-    os << reqNomJourSemaine () << " le ";
+    return string (tampon, ecrireDateFormatee (tampon));
+  }
+
+  /**
+   * \brief écrit la date formatée dans un tampon, sans allocation
+   *        Le texte est identique à celui de reqDateFormatee.
+   * \param[out] p_tampon un tampon d'au moins TAILLE_DATE_FORMATEE_MAX caractères, non terminé par '\0'
+   * \return la position suivant le dernier caractère écrit
+   */
+  char*
+  Date::ecrireDateFormatee (char* p_tampon) const
+  {
+    const char* nomJour = reqNomJourSemaine ();
+    const char* nomMois = reqNomMois ();
+    char* fin = p_tampon + TAILLE_DATE_FORMATEE_MAX;
+
+    p_tampon = std::copy (nomJour, nomJour + strlen (nomJour), p_tampon);
+    p_tampon = std::copy (" le ", " le " + 4, p_tampon);
     if (reqJour () < 10)
       {
-        os << "0";
+        *p_tampon++ = '0';
       }
-    os << reqJour () << " ";
-    os << reqNomMois () << " ";
-    os << reqAnnee ();
-
-    return os.str ();
+    p_tampon = std::to_chars (p_tampon, fin, reqJour ()).ptr;
+    *p_tampon++ = ' ';
+    p_tampon = std::copy (nomMois, nomMois + strlen (nomMois), p_tampon);
+    *p_tampon++ = ' ';
+    return std::to_chars (p_tampon, fin, reqAnnee ()).ptr;
   }
 
   /**
@@ -293,6 +324,25 @@ namespace util
     return valide;
   }
 
+  /**
+   * \brief Fabrique une date sans lancer d'exception
+   *        La date n'est validée qu'une fois, contrairement à un appel à
+   *        validerDate suivi du constructeur.
+   * \param[in] p_jour un entier représentant le jour de la date
+   * \param[in] p_mois un entier représentant le mois de la date
+   * \param[in] p_annee un entier représentant l'année de la date
+   * \return la date, ou std::nullopt si elle n'est pas valide
+   */
+  std::optional<Date>
+  Date::creer (int p_jour, int p_mois, int p_annee)
+  {
+    if (!validerDate (p_jour, p_mois, p_annee))
+      {
+        return std::nullopt;
+      }
+    return Date (p_jour, p_mois, p_annee, AttributsValides ());
+  }
+
   /**
    * \brief surcharge de l'opérateur ==
    * \param[in] p_date à comparer à la date courante
@@ -8,10 +8,19 @@
 #define DATE_H_
 
 #include <string>
+#include <optional>
 
 namespace util
 {
 
+/**
+ * \struct AttributsValides
+ * \brief Étiquette des constructeurs réservés aux fabriques creer(), appelés
+ *        une fois les attributs validés afin de ne pas les valider deux fois.
+ */
+struct AttributsValides {};
+
+
 /**
  * \class Date
  * \brief Cette classe sert au maintien et à la manipulation des dates.
@@ -40,6 +49,7 @@ public:
 
     int reqJourDeAnnee() const; 
     std::string reqDateFormatee() const; 
+    char* ecrireDateFormatee(char* p_tampon) const; 
 
     bool operator==(const Date& p_date) const; 
     bool operator<(const Date& p_date) const; 
@@ -47,12 +57,16 @@ public:
 
     static bool estBissextile(int p_annee); 
     static bool validerDate(int p_jour, int p_mois, int p_annee); 
+    static std::optional<Date> creer(int p_jour, int p_mois, int p_annee); 
+
+    static const std::size_t TAILLE_DATE_FORMATEE_MAX = 40; 
 
     friend std::ostream& operator<<(std::ostream& p_os, const Date& p_date); 
 
 private:
-    std::string reqNomJourSemaine() const; 
-    std::string reqNomMois() const; 
+    Date(int p_jour, int p_mois, int p_annee, AttributsValides); 
+    const char* reqNomJourSemaine() const; 
+    const char* reqNomMois() const; 
     int joursDansLeMois(int p_annee, int p_mois) const; 
     int nbJoursDepuisLaDateDeReference() const; 
     void verifieInvariant() const; 
@@ -12,6 +12,7 @@
 
 #include "Epargne.h"
 #include "ContratException.h"
+#include "Instrumentation.h"
 
 using namespace std;
 namespace bancaire
@@ -23,13 +24,14 @@ namespace bancaire
  * 		  Autrement, une erreur de précondition est générée.
  * \param[in] p_noCompte est un entier positif qui représente le numéro du compte epargne
  * \param[in] p_solde est un nombre décimale qui représente le solde du compte epargne
- * \param[in] p_dateOuverture héritié de la classe date, reçoit trois entiers en paramètre représentant la date d'ouverture du compte epargne
  * \param[in] p_tauxInteret est un nombre décimale qui représente le taux d'intérêt du compte epargne
  * \param[in] p_description est une chaîne de caractères qui représente la description du compte. Description par défaut "Epargne"
+ * \param[in] p_dateOuverture représente la date d'ouverture du compte epargne. Par défaut la date du jour
  * \pre p_solde, p_tauxInteret doivent correspondre à un compte epargne valide 
  */
-Epargne::Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description)       //, const util::Date& p_dateOuverture
-                  : Compte(p_noCompte, p_tauxInteret, p_solde, p_description, util::Date())                                   
+Epargne::Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description,
+                 const util::Date& p_dateOuverture)
+                  : Compte(p_noCompte, p_tauxInteret, p_solde, p_description, p_dateOuverture)                                   
 {
   PRECONDITION (Epargne::validerAttributsEpargne(p_solde, p_tauxInteret));
   
@@ -37,6 +39,51 @@ Epargne::Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, cons
 }
 
 
+/**
+ * \brief constructeur réservé à Epargne::creer, les attributs ayant déjà été validés
+ */
+Epargne::Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description,
+                 const util::Date& p_dateOuverture, util::AttributsValides)
+                  : Compte(p_noCompte, p_tauxInteret, p_solde, p_description, p_dateOuverture, util::AttributsValides())
+{
+  INVARIANTS();
+}
+
+
+/**
+ * \brief constructeur copie dont la description est allouée dans une ressource mémoire
+ * \param[in] p_epargne le compte epargne à copier
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la description
+ */
+Epargne::Epargne(const Epargne& p_epargne, std::pmr::memory_resource* p_ressource)
+                  : Compte(p_epargne, p_ressource)
+{
+}
+
+
+/**
+ * \brief Fabrique un compte epargne sans lancer d'exception
+ *        Les attributs ne sont validés qu'une fois, ce qui convient aux chargements
+ *        en lot où les enregistrements invalides sont attendus.
+ * \param[in] p_noCompte est un entier positif qui représente le numéro du compte epargne
+ * \param[in] p_solde est un nombre décimale qui représente le solde du compte epargne
+ * \param[in] p_tauxInteret est un nombre décimale qui représente le taux d'intérêt du compte epargne
+ * \param[in] p_description est une chaîne de caractères qui représente la description du compte
+ * \param[in] p_dateOuverture représente la date d'ouverture du compte epargne
+ * \return le compte epargne, ou std::nullopt si les attributs ne sont pas valides
+ */
+std::optional<Epargne> Epargne::creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description,
+                                      const util::Date& p_dateOuverture)
+{
+  if (!Compte::validerAttributs(p_noCompte, p_tauxInteret, p_description)
+      || !validerAttributsEpargne(p_solde, p_tauxInteret))
+    {
+      return std::nullopt;
+    }
+  return Epargne(p_noCompte, p_solde, p_tauxInteret, p_description, p_dateOuverture, util::AttributsValides());
+}
+
+
 /**
  * \brief Vérifie la validité des attributs
  * \param[in] p_solde est un nombre décimale qui représente le solde du compte epargne
@@ -82,6 +129,7 @@ Epargne::~Epargne()
  */
 double Epargne::calculerInteret() const
 {
+  MESURER_LATENCE(CALCULER_INTERET);
   return reqSolde() * reqTauxInteret();
 }
 
@@ -96,6 +144,27 @@ std::unique_ptr<Compte> Epargne::clone() const
 }
 
 
+/** 
+ * \brief Méthode virtuelle copiant l'objet courant dans une ressource mémoire, description comprise
+ * \param[in] p_ressource la ressource qui fournit la mémoire de la copie
+ * \return la copie, à détruire par libererDans() avec la même ressource
+ */
+Compte* Epargne::clonerDans(std::pmr::memory_resource* p_ressource) const
+{
+  return copierDans(*this, p_ressource);
+}
+
+
+/** 
+ * \brief Méthode virtuelle détruisant un objet obtenu de clonerDans() et rendant sa mémoire
+ * \param[in] p_ressource la ressource passée à clonerDans()
+ */
+void Epargne::libererDans(std::pmr::memory_resource* p_ressource)
+{
+  libererCopie(this, p_ressource);
+}
+
+
 /**
  * \brief Méthode virtuelle retournant l'ensemble des attributs formatés.
  * \return les informations du compte epargne formatée dans une chaîne de caractères
@@ -11,6 +11,7 @@
 
 #include <string>
 #include <memory>
+#include <optional>
 
 #include "Date.h"
 #include "Compte.h"
@@ -34,17 +35,27 @@ namespace bancaire
 class Epargne : public Compte
 {
 public:
-  Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description = "Epargne");
+  Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description = "Epargne",
+          const util::Date& p_dateOuverture = util::Date());
+  Epargne(const Epargne& p_epargne) = default;
+  Epargne(const Epargne& p_epargne, std::pmr::memory_resource* p_ressource);
  
   virtual ~Epargne(); 
   
   virtual double calculerInteret() const;
   virtual std::unique_ptr<Compte> clone() const override;
+  virtual Compte* clonerDans(std::pmr::memory_resource* p_ressource) const override;
+  virtual void libererDans(std::pmr::memory_resource* p_ressource) override;
   virtual std::string reqCompteFormate() const; 
   
   static bool validerAttributsEpargne(double p_solde, double p_tauxInteret); 
+  static std::optional<Epargne> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description = "Epargne",
+                                      const util::Date& p_dateOuverture = util::Date());
   
 private:
+  Epargne(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description,
+          const util::Date& p_dateOuverture, util::AttributsValides);
+
   void verifieInvariant() const;  
 };
 
@@ -0,0 +1,516 @@
+/**
+ * \file Exportateur.cpp
+ * \brief Implémentation de la classe Exportateur
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "Exportateur.h"
+#include <algorithm>
+#include <charconv>
+#include <cerrno>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "ContratException.h"
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+const char ENTETE_CSV[] = "folio,nom,prenom,dateNaissance,telephone,type,noCompte,description,"
+                          "dateOuverture,tauxInteret,solde,nbrTransactions,tauxInteretMinimum\n";
+const char ENTETE_COLONNES[] = "TP3COL01";
+const std::size_t CAPACITE_MIN = 64;
+const std::size_t TAILLE_NOMBRE_MAX = 32;
+
+enum TypeCompte : std::uint8_t
+{
+  AUCUN = 0,
+  CHEQUE = 1,
+  EPARGNE = 2
+};
+
+TypeCompte typeDe(const Compte& p_compte)
+{
+  if (dynamic_cast<const Cheque*>(&p_compte) != nullptr) return CHEQUE;
+  if (dynamic_cast<const Epargne*>(&p_compte) != nullptr) return EPARGNE;
+  return AUCUN;
+}
+
+const char* nomType(TypeCompte p_type)
+{
+  return p_type == CHEQUE ? "cheque" : p_type == EPARGNE ? "epargne" : "";
+}
+
+/**
+ * \brief Nombre de jours entre le 1970-01-01 et une date
+ */
+std::int32_t joursDepuisEpoque(const util::Date& p_date)
+{
+  static const util::Date epoque(1, 1, 1970);
+  return p_date - epoque;
+}
+}
+
+
+/**
+ * \brief constructeur avec paramètres
+ *        Écrit l'en-tête du format choisi dans le tampon.
+ * \param[in] p_descripteur le descripteur de fichier, ouvert en écriture
+ * \param[in] p_format le format d'export
+ * \param[in] p_capacite la capacité du tampon, en octets (au moins 64)
+ * \pre p_descripteur doit être positif ou nul
+ */
+Exportateur::Exportateur(int p_descripteur, FormatExport p_format, std::size_t p_capacite)
+  : m_descripteur(p_descripteur), m_format(p_format), m_tampon(std::max(p_capacite, CAPACITE_MIN)),
+    m_taille(0), m_nbrLignes(0), m_termine(false)
+{
+  PRECONDITION (p_descripteur >= 0);
+
+  if (m_format == FormatExport::CSV)
+    {
+      ajouter(ENTETE_CSV);
+    }
+  else if (m_format == FormatExport::COLONNES_BINAIRE)
+    {
+      ajouterOctets(ENTETE_COLONNES, sizeof(ENTETE_COLONNES) - 1);
+    }
+
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Destructeur, termine l'export s'il ne l'a pas été
+ *        Une erreur d'écriture à cette étape est ignorée: appeler terminer() pour la détecter.
+ */
+Exportateur::~Exportateur()
+{
+  if (!m_termine)
+    {
+      try
+        {
+          terminer();
+        }
+      catch (const std::exception&)
+        {
+        }
+    }
+}
+
+
+/**
+ * \brief Exporte un client et ses comptes
+ * \param[in] p_client le client à exporter
+ * \pre l'export ne doit pas être terminé
+ * \exception std::runtime_error si l'écriture échoue
+ */
+void Exportateur::exporterClient(const Client& p_client)
+{
+  PRECONDITION (!m_termine);
+
+  switch (m_format)
+    {
+    case FormatExport::CSV:
+      exporterCsv(p_client);
+      break;
+    case FormatExport::JSON_LIGNES:
+      exporterJson(p_client);
+      break;
+    case FormatExport::COLONNES_BINAIRE:
+      exporterColonnes(p_client);
+      break;
+    }
+
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Exporte tous les clients d'une banque, en ordre de folio
+ * \param[in] p_banque la banque à exporter
+ * \pre l'export ne doit pas être terminé
+ * \exception std::runtime_error si l'écriture échoue
+ */
+void Exportateur::exporterBanque(const Banque& p_banque)
+{
+  for (unsigned noFolio = Banque::FOLIO_MIN; noFolio < Banque::FOLIO_MAX; noFolio++)
+    {
+      if (p_banque.estClientPresent(noFolio))
+        {
+          exporterClient(p_banque.reqClient(noFolio));
+        }
+    }
+}
+
+
+/**
+ * \brief Termine l'export: écrit le dernier groupe de colonnes et vide le tampon
+ * \post l'export est terminé, aucun client ne peut plus être exporté
+ * \exception std::runtime_error si l'écriture échoue
+ */
+void Exportateur::terminer()
+{
+  if (m_termine)
+    {
+      return;
+    }
+  m_termine = true;
+  if (m_format == FormatExport::COLONNES_BINAIRE)
+    {
+      if (!m_folios.empty())
+        {
+          viderGroupe();
+        }
+      std::uint32_t fin = 0;
+      ajouterOctets(&fin, sizeof(fin));
+    }
+  vider();
+}
+
+
+/**
+ * \brief méthode accesseur retournant le nombre de lignes exportées
+ * \return le nombre de lignes CSV ou de colonnes, ou le nombre d'objets JSON
+ */
+std::uint64_t Exportateur::reqNbrLignes() const
+{
+  return m_nbrLignes;
+}
+
+
+void Exportateur::exporterCsv(const Client& p_client)
+{
+  size_t nbrComptes = p_client.reqNbrComptes();
+  for (size_t i = 0; i == 0 || i < nbrComptes; i++)
+    {
+      ajouterEntier(p_client.reqNoFolio());
+      ajouter(",");
+      ajouterChampCsv(p_client.reqNomVue());
+      ajouter(",");
+      ajouterChampCsv(p_client.reqPrenomVue());
+      ajouter(",");
+      ajouterDate(p_client.reqDateNaissanceRef());
+      ajouter(",");
+      char telephone[Client::TAILLE_TELEPHONE_FORMATE];
+      Client::formaterTelephone(p_client.reqNoTelephone(), telephone);
+      ajouter(std::string_view(telephone, 3));
+      ajouter(std::string_view(telephone + 4, 3));
+      ajouter(std::string_view(telephone + 8, 4));
+      ajouter(",");
+      if (nbrComptes == 0)
+        {
+          ajouter(",,,,,,,\n");
+        }
+      else
+        {
+          const Compte& compte = p_client.reqCompte(i);
+          TypeCompte type = typeDe(compte);
+          ajouter(nomType(type));
+          ajouter(",");
+          ajouterEntier(compte.reqNoCompte());
+          ajouter(",");
+          ajouterChampCsv(compte.reqDescriptionVue());
+          ajouter(",");
+          ajouterDate(compte.reqDateOuvertureRef());
+          ajouter(",");
+          ajouterDecimal(compte.reqTauxInteret());
+          ajouter(",");
+          ajouterDecimal(compte.reqSolde());
+          ajouter(",");
+          if (type == CHEQUE)
+            {
+              const Cheque& cheque = static_cast<const Cheque&>(compte);
+              ajouterEntier(cheque.reqNbrTransactions());
+              ajouter(",");
+              ajouterDecimal(cheque.reqTauxInteretMinimum());
+            }
+          else
+            {
+              ajouter(",");
+            }
+          ajouter("\n");
+        }
+      m_nbrLignes++;
+    }
+}
+
+
+void Exportateur::exporterJson(const Client& p_client)
+{
+  ajouter("{\"folio\":");
+  ajouterEntier(p_client.reqNoFolio());
+  ajouter(",\"nom\":");
+  ajouterChaineJson(p_client.reqNomVue());
+  ajouter(",\"prenom\":");
+  ajouterChaineJson(p_client.reqPrenomVue());
+  ajouter(",\"dateNaissance\":\"");
+  ajouterDate(p_client.reqDateNaissanceRef());
+  ajouter("\",\"telephone\":\"");
+  char telephone[Client::TAILLE_TELEPHONE_FORMATE];
+  Client::formaterTelephone(p_client.reqNoTelephone(), telephone);
+  ajouter(std::string_view(telephone, 3));
+  ajouter(std::string_view(telephone + 4, 3));
+  ajouter(std::string_view(telephone + 8, 4));
+  ajouter("\",\"comptes\":[");
+  for (size_t i = 0; i < p_client.reqNbrComptes(); i++)
+    {
+      const Compte& compte = p_client.reqCompte(i);
+      TypeCompte type = typeDe(compte);
+      ajouter(i == 0 ? "{\"type\":\"" : ",{\"type\":\"");
+      ajouter(nomType(type));
+      ajouter("\",\"noCompte\":");
+      ajouterEntier(compte.reqNoCompte());
+      ajouter(",\"description\":");
+      ajouterChaineJson(compte.reqDescriptionVue());
+      ajouter(",\"dateOuverture\":\"");
+      ajouterDate(compte.reqDateOuvertureRef());
+      ajouter("\",\"tauxInteret\":");
+      ajouterDecimal(compte.reqTauxInteret());
+      ajouter(",\"solde\":");
+      ajouterDecimal(compte.reqSolde());
+      if (type == CHEQUE)
+        {
+          const Cheque& cheque = static_cast<const Cheque&>(compte);
+          ajouter(",\"nbrTransactions\":");
+          ajouterEntier(cheque.reqNbrTransactions());
+          ajouter(",\"tauxInteretMinimum\":");
+          ajouterDecimal(cheque.reqTauxInteretMinimum());
+        }
+      ajouter("}");
+    }
+  ajouter("]}\n");
+  m_nbrLignes++;
+}
+
+
+void Exportateur::exporterColonnes(const Client& p_client)
+{
+  if (p_client.reqNbrComptes() == 0)
+    {
+      ajouterLigneColonnes(p_client.reqNoFolio(), nullptr);
+    }
+  for (size_t i = 0; i < p_client.reqNbrComptes(); i++)
+    {
+      ajouterLigneColonnes(p_client.reqNoFolio(), &p_client.reqCompte(i));
+    }
+}
+
+
+/**
+ * \brief Ajoute une ligne au groupe de colonnes courant, écrit le groupe lorsqu'il est plein
+ * \param[in] p_noFolio le folio du client
+ * \param[in] p_compte le compte, nullptr pour un client sans compte
+ */
+void Exportateur::ajouterLigneColonnes(unsigned p_noFolio, const Compte* p_compte)
+{
+  TypeCompte type = p_compte != nullptr ? typeDe(*p_compte) : AUCUN;
+  const Cheque* cheque = type == CHEQUE ? static_cast<const Cheque*>(p_compte) : nullptr;
+  std::string_view description = p_compte != nullptr ? p_compte->reqDescriptionVue() : std::string_view();
+
+  m_folios.push_back(p_noFolio);
+  m_types.push_back(type);
+  m_noComptes.push_back(p_compte != nullptr ? p_compte->reqNoCompte() : 0);
+  m_soldes.push_back(p_compte != nullptr ? p_compte->reqSolde() : 0.0);
+  m_taux.push_back(p_compte != nullptr ? p_compte->reqTauxInteret() : 0.0);
+  m_datesOuverture.push_back(p_compte != nullptr ? joursDepuisEpoque(p_compte->reqDateOuvertureRef()) : 0);
+  m_nbrTransactions.push_back(cheque != nullptr ? cheque->reqNbrTransactions() : 0);
+  m_tauxMinimums.push_back(cheque != nullptr ? cheque->reqTauxInteretMinimum() : 0.0);
+  m_longueursDescriptions.push_back(static_cast<std::uint32_t>(description.size()));
+  m_descriptions.insert(m_descriptions.end(), description.begin(), description.end());
+  m_nbrLignes++;
+
+  if (m_folios.size() == TAILLE_GROUPE)
+    {
+      viderGroupe();
+    }
+}
+
+
+/**
+ * \brief Écrit le groupe de colonnes courant dans le tampon et le vide, sans libérer sa mémoire
+ */
+void Exportateur::viderGroupe()
+{
+  std::uint32_t nbrLignes = static_cast<std::uint32_t>(m_folios.size());
+  ajouterOctets(&nbrLignes, sizeof(nbrLignes));
+  ajouterOctets(m_folios.data(), m_folios.size() * sizeof(m_folios[0]));
+  ajouterOctets(m_types.data(), m_types.size() * sizeof(m_types[0]));
+  ajouterOctets(m_noComptes.data(), m_noComptes.size() * sizeof(m_noComptes[0]));
+  ajouterOctets(m_soldes.data(), m_soldes.size() * sizeof(m_soldes[0]));
+  ajouterOctets(m_taux.data(), m_taux.size() * sizeof(m_taux[0]));
+  ajouterOctets(m_datesOuverture.data(), m_datesOuverture.size() * sizeof(m_datesOuverture[0]));
+  ajouterOctets(m_nbrTransactions.data(), m_nbrTransactions.size() * sizeof(m_nbrTransactions[0]));
+  ajouterOctets(m_tauxMinimums.data(), m_tauxMinimums.size() * sizeof(m_tauxMinimums[0]));
+  ajouterOctets(m_longueursDescriptions.data(), m_longueursDescriptions.size() * sizeof(m_longueursDescriptions[0]));
+  ajouterOctets(m_descriptions.data(), m_descriptions.size());
+
+  m_folios.clear();
+  m_types.clear();
+  m_noComptes.clear();
+  m_soldes.clear();
+  m_taux.clear();
+  m_datesOuverture.clear();
+  m_nbrTransactions.clear();
+  m_tauxMinimums.clear();
+  m_longueursDescriptions.clear();
+  m_descriptions.clear();
+}
+
+
+void Exportateur::ajouter(std::string_view p_texte)
+{
+  ajouterOctets(p_texte.data(), p_texte.size());
+}
+
+
+/**
+ * \brief Copie des octets dans le tampon, en l'écrivant chaque fois qu'il est plein
+ */
+void Exportateur::ajouterOctets(const void* p_donnees, std::size_t p_taille)
+{
+  const char* donnees = static_cast<const char*>(p_donnees);
+  while (p_taille > 0)
+    {
+      if (m_taille == m_tampon.size())
+        {
+          vider();
+        }
+      std::size_t morceau = std::min(p_taille, m_tampon.size() - m_taille);
+      std::copy(donnees, donnees + morceau, m_tampon.data() + m_taille);
+      m_taille += morceau;
+      donnees += morceau;
+      p_taille -= morceau;
+    }
+}
+
+
+void Exportateur::ajouterEntier(long long p_valeur)
+{
+  char nombre[TAILLE_NOMBRE_MAX];
+  ajouter(std::string_view(nombre, std::to_chars(nombre, nombre + TAILLE_NOMBRE_MAX, p_valeur).ptr - nombre));
+}
+
+
+/**
+ * \brief Ajoute un nombre décimal dans sa plus courte écriture qui le relit exactement
+ */
+void Exportateur::ajouterDecimal(double p_valeur)
+{
+  char nombre[TAILLE_NOMBRE_MAX];
+  ajouter(std::string_view(nombre, std::to_chars(nombre, nombre + TAILLE_NOMBRE_MAX, p_valeur).ptr - nombre));
+}
+
+
+/**
+ * \brief Ajoute une date au format AAAA-MM-JJ
+ */
+void Exportateur::ajouterDate(const util::Date& p_date)
+{
+  char date[TAILLE_NOMBRE_MAX];
+  char* fin = std::to_chars(date, date + TAILLE_NOMBRE_MAX, p_date.reqAnnee()).ptr;
+  *fin++ = '-';
+  *fin++ = static_cast<char>('0' + p_date.reqMois() / 10);
+  *fin++ = static_cast<char>('0' + p_date.reqMois() % 10);
+  *fin++ = '-';
+  *fin++ = static_cast<char>('0' + p_date.reqJour() / 10);
+  *fin++ = static_cast<char>('0' + p_date.reqJour() % 10);
+  ajouter(std::string_view(date, fin - date));
+}
+
+
+/**
+ * \brief Ajoute un champ CSV, entre guillemets s'il contient une virgule, un guillemet ou une fin de ligne
+ */
+void Exportateur::ajouterChampCsv(std::string_view p_texte)
+{
+  if (p_texte.find_first_of(",\"\r\n") == std::string_view::npos)
+    {
+      ajouter(p_texte);
+      return;
+    }
+  ajouter("\"");
+  for (std::size_t guillemet = p_texte.find('"'); guillemet != std::string_view::npos; guillemet = p_texte.find('"'))
+    {
+      ajouter(p_texte.substr(0, guillemet + 1));
+      ajouter("\"");
+      p_texte.remove_prefix(guillemet + 1);
+    }
+  ajouter(p_texte);
+  ajouter("\"");
+}
+
+
+/**
+ * \brief Ajoute une chaîne JSON entre guillemets; les caractères UTF-8 sont conservés tels quels
+ */
+void Exportateur::ajouterChaineJson(std::string_view p_texte)
+{
+  static const char HEXADECIMAL[] = "0123456789abcdef";
+
+  ajouter("\"");
+  std::size_t debut = 0;
+  for (std::size_t i = 0; i < p_texte.size(); i++)
+    {
+      unsigned char caractere = static_cast<unsigned char>(p_texte[i]);
+      if (caractere == '"' || caractere == '\\' || caractere < 0x20)
+        {
+          ajouter(p_texte.substr(debut, i - debut));
+          char echappement[6] = {'\\', 'u', '0', '0', HEXADECIMAL[caractere >> 4], HEXADECIMAL[caractere & 0xF]};
+          if (caractere == '"' || caractere == '\\')
+            {
+              ajouter(std::string_view(echappement, 1));
+              ajouter(std::string_view(p_texte.data() + i, 1));
+            }
+          else
+            {
+              ajouter(std::string_view(echappement, sizeof(echappement)));
+            }
+          debut = i + 1;
+        }
+    }
+  ajouter(p_texte.substr(debut));
+  ajouter("\"");
+}
+
+
+/**
+ * \brief Écrit le contenu du tampon dans le descripteur
+ * \exception std::runtime_error si l'écriture échoue
+ */
+void Exportateur::vider()
+{
+  const char* donnees = m_tampon.data();
+  std::size_t reste = m_taille;
+  while (reste > 0)
+    {
+      ssize_t ecrits = ::write(m_descripteur, donnees, reste);
+      if (ecrits < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+          throw std::runtime_error("Erreur d'écriture lors de l'export");
+        }
+      donnees += ecrits;
+      reste -= static_cast<std::size_t>(ecrits);
+    }
+  m_taille = 0;
+}
+
+
+/**
+ * \brief Teste l'invariant de la classe Exportateur
+ */
+void Exportateur::verifieInvariant() const
+{
+  INVARIANT (m_taille <= m_tampon.size());
+  INVARIANT (m_folios.size() < TAILLE_GROUPE);
+}
+
+} // namespace bancaire
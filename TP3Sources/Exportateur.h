@@ -0,0 +1,113 @@
+/**
+ * \file Exportateur.h
+ * \brief Fichier qui contient l'interface de la classe Exportateur qui sert à l'export des clients et des comptes.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef EXPORTATEUR_H
+#define EXPORTATEUR_H
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+#include "Client.h"
+#include "Banque.h"
+
+namespace bancaire
+{
+/**
+ * \brief Formats d'export lisibles par machine
+ *
+ *        CSV:              une ligne par compte, précédée des colonnes du client;
+ *                          un client sans compte occupe une ligne aux colonnes de compte vides
+ *        JSON_LIGNES:      un objet JSON par client, ses comptes dans le tableau "comptes"
+ *        COLONNES_BINAIRE: voir la classe Exportateur
+ */
+enum class FormatExport
+{
+  CSV,
+  JSON_LIGNES,
+  COLONNES_BINAIRE
+};
+
+
+/**
+ * \class Exportateur
+ * \brief Classe servant à l'export en continu des clients et de leurs comptes vers un descripteur de fichier.
+ *
+ *              Le texte ou les octets sont accumulés dans un tampon de taille fixe, écrit
+ *              d'un bloc avec write() lorsqu'il est plein: la mémoire utilisée ne dépend
+ *              pas du nombre de comptes exportés. Le descripteur n'est pas fermé.
+ *              Les dates sont au format AAAA-MM-JJ en CSV et en JSON.
+ *
+ *              Le format COLONNES_BINAIRE, dans l'ordre des octets de la machine, débute par
+ *              l'en-tête de 8 octets "TP3COL01", suivi de groupes d'au plus TAILLE_GROUPE
+ *              lignes, une ligne par compte (ou par client sans compte). Chaque groupe contient
+ *              son nombre de lignes n (uint32) puis les colonnes:
+ *              folio uint32[n], type uint8[n] (0 aucun compte, 1 cheque, 2 epargne),
+ *              noCompte uint32[n], solde double[n], tauxInteret double[n],
+ *              dateOuverture int32[n] (jours depuis le 1970-01-01), nbrTransactions uint32[n],
+ *              tauxInteretMinimum double[n], longueurs des descriptions uint32[n] et
+ *              les descriptions concaténées. Un groupe de 0 ligne termine le fichier.
+ * \invariant le tampon n'est jamais plus rempli que sa capacité
+ */
+class Exportateur
+{
+public:
+  Exportateur(int p_descripteur, FormatExport p_format, std::size_t p_capacite = CAPACITE_DEFAUT);
+  ~Exportateur();
+
+  void exporterClient(const Client& p_client);
+  void exporterBanque(const Banque& p_banque);
+  void terminer();
+
+  std::uint64_t reqNbrLignes() const;
+
+  static const std::size_t CAPACITE_DEFAUT = 1 << 20;
+  static const std::size_t TAILLE_GROUPE = 65536;
+
+private:
+  Exportateur(const Exportateur&) = delete;
+  Exportateur& operator=(const Exportateur&) = delete;
+
+  void exporterCsv(const Client& p_client);
+  void exporterJson(const Client& p_client);
+  void exporterColonnes(const Client& p_client);
+  void ajouterLigneColonnes(unsigned p_noFolio, const Compte* p_compte);
+  void viderGroupe();
+
+  void ajouter(std::string_view p_texte);
+  void ajouterOctets(const void* p_donnees, std::size_t p_taille);
+  void ajouterEntier(long long p_valeur);
+  void ajouterDecimal(double p_valeur);
+  void ajouterDate(const util::Date& p_date);
+  void ajouterChampCsv(std::string_view p_texte);
+  void ajouterChaineJson(std::string_view p_texte);
+  void vider();
+  void verifieInvariant() const;
+
+  int m_descripteur;
+  FormatExport m_format;
+  std::vector<char> m_tampon;
+  std::size_t m_taille;
+  std::uint64_t m_nbrLignes;
+  bool m_termine;
+
+  std::vector<std::uint32_t> m_folios;
+  std::vector<std::uint8_t> m_types;
+  std::vector<std::uint32_t> m_noComptes;
+  std::vector<double> m_soldes;
+  std::vector<double> m_taux;
+  std::vector<std::int32_t> m_datesOuverture;
+  std::vector<std::uint32_t> m_nbrTransactions;
+  std::vector<double> m_tauxMinimums;
+  std::vector<std::uint32_t> m_longueursDescriptions;
+  std::vector<char> m_descriptions;
+};
+
+} // namespace bancaire
+
+#endif /* EXPORTATEUR_H */
@@ -0,0 +1,205 @@
+/**
+ * \file FormateurReleve.cpp
+ * \brief Implémentation de la classe FormateurReleve
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "FormateurReleve.h"
+#include <algorithm>
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+// plus long rendu d'un double: "%.3g" ou "%.0f" d'un double fini (au plus 309 chiffres)
+const std::size_t TAILLE_DECIMAL_MAX = 330;
+const std::size_t TAILLE_ENTIER_MAX = 20;
+}
+
+
+/**
+ * \brief constructeur par défaut
+ * \post le tampon a une capacité de CAPACITE_INITIALE caractères
+ */
+FormateurReleve::FormateurReleve() : m_tampon(CAPACITE_INITIALE), m_taille(0)
+{
+}
+
+
+/**
+ * \brief Rend un compte comme le fait sa méthode reqCompteFormate
+ * \param[in] p_compte le compte à rendre
+ * \return le texte rendu, valide jusqu'au prochain rendu de ce formateur
+ */
+std::string_view FormateurReleve::formaterCompte(const Compte& p_compte)
+{
+  m_taille = 0;
+  ajouterCompte(p_compte);
+  return reqTexte();
+}
+
+
+/**
+ * \brief Rend un client comme le fait Client::reqClientFormate
+ * \param[in] p_client le client à rendre
+ * \return le texte rendu, valide jusqu'au prochain rendu de ce formateur
+ */
+std::string_view FormateurReleve::formaterClient(const Client& p_client)
+{
+  m_taille = 0;
+  ajouterClient(p_client);
+  return reqTexte();
+}
+
+
+/**
+ * \brief Rend le relevé d'un client et de ses comptes comme le fait Client::reqReleves
+ * \param[in] p_client le client à rendre
+ * \return le texte rendu, valide jusqu'au prochain rendu de ce formateur
+ */
+std::string_view FormateurReleve::formaterReleves(const Client& p_client)
+{
+  m_taille = 0;
+  ajouterClient(p_client);
+  for (std::size_t i = 0; i < p_client.reqNbrComptes(); i++)
+    {
+      ajouterCompte(p_client.reqCompte(i));
+      ajouter("\n");
+    }
+  return reqTexte();
+}
+
+
+/**
+ * \brief Retourne le formateur du fil d'exécution courant
+ * \return un formateur dont le tampon est réutilisé d'un rendu à l'autre dans ce fil
+ */
+FormateurReleve& FormateurReleve::duFil()
+{
+  thread_local FormateurReleve formateur;
+  return formateur;
+}
+
+
+/**
+ * \brief Réserve de la place à la fin du texte, en agrandissant le tampon au besoin
+ * \param[in] p_nbCaracteres le nombre de caractères à réserver
+ * \return la position où écrire
+ */
+char* FormateurReleve::reserver(std::size_t p_nbCaracteres)
+{
+  if (m_taille + p_nbCaracteres > m_tampon.size())
+    {
+      m_tampon.resize(std::max(2 * m_tampon.size(), m_taille + p_nbCaracteres));
+    }
+  return m_tampon.data() + m_taille;
+}
+
+
+void FormateurReleve::ajouter(std::string_view p_texte)
+{
+  char* position = reserver(p_texte.size());
+  std::copy(p_texte.begin(), p_texte.end(), position);
+  m_taille += p_texte.size();
+}
+
+
+void FormateurReleve::ajouterEntier(unsigned long long p_valeur)
+{
+  char* position = reserver(TAILLE_ENTIER_MAX);
+  m_taille = std::to_chars(position, position + TAILLE_ENTIER_MAX, p_valeur).ptr - m_tampon.data();
+}
+
+
+/**
+ * \brief Ajoute un nombre décimal, comme un flux réglé avec setprecision(p_precision)
+ *        (std::chars_format::general) ou avec fixed et setprecision (std::chars_format::fixed)
+ */
+void FormateurReleve::ajouterDecimal(double p_valeur, std::chars_format p_format, int p_precision)
+{
+  char* position = reserver(TAILLE_DECIMAL_MAX);
+  m_taille = std::to_chars(position, position + TAILLE_DECIMAL_MAX, p_valeur, p_format, p_precision).ptr - m_tampon.data();
+}
+
+
+void FormateurReleve::ajouterDate(const util::Date& p_date)
+{
+  char* position = reserver(util::Date::TAILLE_DATE_FORMATEE_MAX);
+  m_taille = p_date.ecrireDateFormatee(position) - m_tampon.data();
+}
+
+
+/**
+ * \brief Ajoute le rendu d'un compte, selon sa classe: Cheque, Epargne ou Compte
+ */
+void FormateurReleve::ajouterCompte(const Compte& p_compte)
+{
+  const Cheque* cheque = dynamic_cast<const Cheque*>(&p_compte);
+  const Epargne* epargne = dynamic_cast<const Epargne*>(&p_compte);
+
+  if (cheque != nullptr)
+    {
+      ajouter("Compte Cheque\n");
+    }
+  else if (epargne != nullptr)
+    {
+      ajouter("Compte Epargne\n");
+    }
+
+  ajouter("Numero : ");
+  ajouterEntier(p_compte.reqNoCompte());
+  ajouter("\nDescription : ");
+  ajouter(p_compte.reqDescriptionVue());
+  ajouter("\nDate d'ouverture : ");
+  ajouterDate(p_compte.reqDateOuvertureRef());
+  ajouter("\nTaux d'intérêt : ");
+  ajouterDecimal(p_compte.reqTauxInteret(), std::chars_format::general, 3);
+  ajouter("\nSolde : ");
+  ajouterDecimal(p_compte.reqSolde(), std::chars_format::fixed, 0);
+  ajouter("$\n");
+
+  if (cheque != nullptr)
+    {
+      ajouter("Nombre de transactions : ");
+      ajouterEntier(cheque->reqNbrTransactions());
+      ajouter("\nTaux d'intérêt minimum : ");
+      ajouterDecimal(cheque->reqTauxInteretMinimum(), std::chars_format::general, 3);
+      ajouter("\nInteret : ");
+      ajouterDecimal(cheque->calculerInteret(), std::chars_format::general, 3);
+      ajouter("$");
+    }
+  else if (epargne != nullptr)
+    {
+      ajouter("Interet : ");
+      ajouterDecimal(epargne->calculerInteret() / 100, std::chars_format::general, 3);
+      ajouter("$");
+    }
+}
+
+
+void FormateurReleve::ajouterClient(const Client& p_client)
+{
+  ajouter("Client no de folio : ");
+  ajouterEntier(p_client.reqNoFolio());
+  ajouter("\n");
+  ajouter(p_client.reqPrenomVue());
+  ajouter(" ");
+  ajouter(p_client.reqNomVue());
+  ajouter("\nDate de naissance : ");
+  ajouterDate(p_client.reqDateNaissanceRef());
+  ajouter("\n");
+  Client::formaterTelephone(p_client.reqNoTelephone(), reserver(Client::TAILLE_TELEPHONE_FORMATE));
+  m_taille += Client::TAILLE_TELEPHONE_FORMATE;
+  ajouter("\n");
+}
+
+
+std::string_view FormateurReleve::reqTexte() const
+{
+  return std::string_view(m_tampon.data(), m_taille);
+}
+
+} // namespace bancaire
@@ -0,0 +1,62 @@
+/**
+ * \file FormateurReleve.h
+ * \brief Fichier qui contient l'interface de la classe FormateurReleve qui sert au rendu des relevés sans allocation.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef FORMATEURRELEVE_H
+#define FORMATEURRELEVE_H
+
+#include <string_view>
+#include <vector>
+#include <charconv>
+
+#include "Compte.h"
+#include "Client.h"
+
+namespace bancaire
+{
+/**
+ * \class FormateurReleve
+ * \brief Classe servant au rendu des comptes et des relevés des clients dans un tampon réutilisable.
+ *
+ *              Le texte produit est identique, octet pour octet, à celui de
+ *              Compte::reqCompteFormate, Client::reqClientFormate et Client::reqReleves.
+ *              Les nombres sont écrits avec std::to_chars, sans flux ni locale, et
+ *              le tampon n'est agrandi que lorsqu'un relevé dépasse sa capacité:
+ *              une fois celle-ci atteinte, le rendu ne fait plus aucune allocation.
+ *              Le texte retourné reste valide jusqu'au prochain rendu du même formateur.
+ *              duFil() fournit un formateur propre à chaque fil d'exécution.
+ */
+class FormateurReleve
+{
+public:
+  FormateurReleve();
+
+  std::string_view formaterCompte(const Compte& p_compte);
+  std::string_view formaterClient(const Client& p_client);
+  std::string_view formaterReleves(const Client& p_client);
+
+  static FormateurReleve& duFil();
+
+  static const std::size_t CAPACITE_INITIALE = 4096;
+
+private:
+  std::vector<char> m_tampon;
+  std::size_t m_taille;
+
+  char* reserver(std::size_t p_nbCaracteres);
+  void ajouter(std::string_view p_texte);
+  void ajouterEntier(unsigned long long p_valeur);
+  void ajouterDecimal(double p_valeur, std::chars_format p_format, int p_precision);
+  void ajouterDate(const util::Date& p_date);
+  void ajouterCompte(const Compte& p_compte);
+  void ajouterClient(const Client& p_client);
+  std::string_view reqTexte() const;
+};
+
+} // namespace bancaire
+
+#endif /* FORMATEURRELEVE_H */
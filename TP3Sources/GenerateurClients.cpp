@@ -0,0 +1,477 @@
+/**
+ * \file GenerateurClients.cpp
+ * \brief Implémentation de la classe GenerateurClients
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "GenerateurClients.h"
+#include <algorithm>
+#include <charconv>
+#include <cerrno>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Exportateur.h"
+#include "ContratException.h"
+#include "GroupeFils.h"
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+const char* const NOMS[] = {"Dortelus", "Tremblay", "Gagnon", "Roy", "Côté", "Bouchard", "Gauthier", "Morin",
+                            "Lavoie", "Fortin", "Gagné", "Ouellet", "Pelletier", "Bélanger", "Lévesque", "Bergeron"};
+const char* const PRENOMS[] = {"Judith", "Marc", "Anne", "Émile", "Chloé", "Louis", "Léa", "Olivier",
+                               "Zoé", "Félix", "Alice", "Samuel", "Jade", "William", "Rose", "Thomas"};
+const char* const DESCRIPTIONS_CHEQUE[] = {"Compte courant", "Compte conjoint", "Compte entreprise", "Compte etudiant"};
+const char* const DESCRIPTIONS_EPARGNE[] = {"Reer", "Celi", "Reee", "Epargne"};
+const char* const INDICATIFS[] = {"418", "514", "450", "819", "581", "438"};
+
+const unsigned PALIERS[4][2] = {{0, 10}, {11, 25}, {26, 35}, {36, 40}};
+const double SOLDE_MAX = 1e9;
+const double DEUX_PI = 6.283185307179586;
+const double TAUX_EPARGNE_MIN = 0.1;
+const double TAUX_EPARGNE_MAX = 3.5;
+
+/**
+ * \class Aleatoire
+ * \brief Générateur pseudo-aléatoire SplitMix64: rapide, sans état partagé et
+ *        reproductible d'une plateforme à l'autre, contrairement aux lois de <random>
+ */
+class Aleatoire
+{
+public:
+  Aleatoire (std::uint64_t p_graine, std::uint64_t p_rang)
+    : m_etat(p_graine ^ (p_rang * 0xD1B54A32D192ED03ull))
+  {
+    suivant();
+  }
+
+  std::uint64_t suivant ()
+  {
+    std::uint64_t z = (m_etat += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  /** \brief Réel uniforme dans [0, 1[ */
+  double uniforme ()
+  {
+    return static_cast<double>(suivant() >> 11) * 0x1.0p-53;
+  }
+
+  /** \brief Entier uniforme dans [0, p_borne[ */
+  std::uint64_t entier (std::uint64_t p_borne)
+  {
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(suivant()) * p_borne) >> 64);
+  }
+
+  /** \brief Variable normale centrée réduite, par la méthode de Box-Muller */
+  double normale ()
+  {
+    const double u = 1.0 - uniforme();
+    return std::sqrt(-2.0 * std::log(u)) * std::cos(DEUX_PI * uniforme());
+  }
+
+private:
+  std::uint64_t m_etat;
+};
+
+struct CompteGenere
+{
+  bool m_estCheque;
+  unsigned m_noCompte;
+  std::int64_t m_tauxCentiemes;
+  std::int64_t m_soldeCentimes;
+  const char* m_description;
+  unsigned m_nbrTransactions;
+  std::int64_t m_tauxMinimumCentiemes;
+  int m_jourOuverture;
+  int m_moisOuverture;
+  int m_anneeOuverture;
+};
+
+struct ClientGenere
+{
+  const char* m_nom;
+  const char* m_prenom;
+  int m_jourNaissance;
+  int m_moisNaissance;
+  int m_anneeNaissance;
+  char m_telephone[13];
+  unsigned m_noFolio;
+  std::vector<CompteGenere> m_comptes;
+};
+
+template<typename T, std::size_t N>
+const T& choisir (const T (&p_valeurs)[N], Aleatoire& p_aleatoire)
+{
+  return p_valeurs[p_aleatoire.entier(N)];
+}
+
+unsigned tirerNbrComptes (const ParametresGeneration& p_parametres, Aleatoire& p_aleatoire)
+{
+  const unsigned min = p_parametres.m_nbrComptesMin;
+  const unsigned max = p_parametres.m_nbrComptesMax;
+  if (p_parametres.m_distributionComptes == DistributionComptes::UNIFORME)
+    {
+      return min + static_cast<unsigned>(p_aleatoire.entier(max - min + 1));
+    }
+  const double moyenne = p_parametres.m_nbrComptesMoyen - min;
+  if (moyenne <= 0.0)
+    {
+      return min;
+    }
+  const double surplus = std::floor(std::log(1.0 - p_aleatoire.uniforme()) / std::log(moyenne / (moyenne + 1.0)));
+  return surplus >= max - min ? max : min + static_cast<unsigned>(surplus);
+}
+
+std::int64_t tirerSolde (const ParametresGeneration& p_parametres, Aleatoire& p_aleatoire)
+{
+  const double solde = p_parametres.m_soldeMedian * std::exp(p_parametres.m_soldeDispersion * p_aleatoire.normale());
+  return std::llround(std::min(solde, SOLDE_MAX) * 100.0);
+}
+
+unsigned tirerNbrTransactions (const ParametresGeneration& p_parametres, double p_sommePoids, Aleatoire& p_aleatoire)
+{
+  double tirage = p_aleatoire.uniforme() * p_sommePoids;
+  int palier = 0;
+  while (palier < 3 && tirage >= p_parametres.m_poidsPaliers[palier])
+    {
+      tirage -= p_parametres.m_poidsPaliers[palier];
+      palier++;
+    }
+  return PALIERS[palier][0] + static_cast<unsigned>(p_aleatoire.entier(PALIERS[palier][1] - PALIERS[palier][0] + 1));
+}
+
+/**
+ * \brief Tire tous les attributs du client de rang p_rang; le résultat ne dépend que de la graine et du rang
+ */
+void tirerClient (const ParametresGeneration& p_parametres, std::uint64_t p_rang, ClientGenere& p_client)
+{
+  Aleatoire aleatoire(p_parametres.m_graine, p_rang);
+  const double sommePoids = p_parametres.m_poidsPaliers[0] + p_parametres.m_poidsPaliers[1]
+                          + p_parametres.m_poidsPaliers[2] + p_parametres.m_poidsPaliers[3];
+
+  p_client.m_nom = choisir(NOMS, aleatoire);
+  p_client.m_prenom = choisir(PRENOMS, aleatoire);
+  p_client.m_jourNaissance = 1 + static_cast<int>(aleatoire.entier(28));
+  p_client.m_moisNaissance = 1 + static_cast<int>(aleatoire.entier(12));
+  p_client.m_anneeNaissance = 1970 + static_cast<int>(aleatoire.entier(36));
+  const unsigned central = 200 + static_cast<unsigned>(aleatoire.entier(800));
+  const unsigned poste = static_cast<unsigned>(aleatoire.entier(10000));
+  char* fin = std::copy_n(choisir(INDICATIFS, aleatoire), 3, p_client.m_telephone);
+  *fin++ = ' ';
+  fin = std::to_chars(fin, fin + 3, central).ptr;
+  *fin++ = '-';
+  for (unsigned diviseur = 1000; diviseur > 0; diviseur /= 10)
+    {
+      *fin++ = static_cast<char>('0' + poste / diviseur % 10);
+    }
+  *fin = '\0';
+  // seulement 9000 folios valides: ils se répètent au-delà de 9000 clients
+  p_client.m_noFolio = 1000 + static_cast<unsigned>(p_rang % 9000);
+
+  const unsigned nbrComptes = tirerNbrComptes(p_parametres, aleatoire);
+  p_client.m_comptes.resize(nbrComptes);
+  unsigned noCompte = 10 + static_cast<unsigned>(aleatoire.entier(90));
+  for (CompteGenere& compte : p_client.m_comptes)
+    {
+      compte.m_noCompte = noCompte;
+      noCompte += 1 + static_cast<unsigned>(aleatoire.entier(9));
+      compte.m_estCheque = aleatoire.uniforme() < p_parametres.m_proportionCheques;
+      compte.m_soldeCentimes = tirerSolde(p_parametres, aleatoire);
+      if (compte.m_estCheque)
+        {
+          if (aleatoire.uniforme() < p_parametres.m_proportionDecouverts)
+            {
+              compte.m_soldeCentimes = -compte.m_soldeCentimes / 10;
+            }
+          compte.m_tauxCentiemes = 11 + static_cast<std::int64_t>(aleatoire.entier(140));
+          compte.m_description = choisir(DESCRIPTIONS_CHEQUE, aleatoire);
+          compte.m_nbrTransactions = tirerNbrTransactions(p_parametres, sommePoids, aleatoire);
+          compte.m_tauxMinimumCentiemes = 10 + static_cast<std::int64_t>(aleatoire.entier(compte.m_tauxCentiemes - 10));
+        }
+      else
+        {
+          const std::int64_t tauxMin = std::llround(p_parametres.m_tauxEpargneMin * 100.0);
+          const std::int64_t tauxMax = std::llround(p_parametres.m_tauxEpargneMax * 100.0);
+          compte.m_tauxCentiemes = tauxMin + static_cast<std::int64_t>(aleatoire.entier(tauxMax - tauxMin + 1));
+          compte.m_description = choisir(DESCRIPTIONS_EPARGNE, aleatoire);
+          compte.m_jourOuverture = 1 + static_cast<int>(aleatoire.entier(28));
+          compte.m_moisOuverture = 1 + static_cast<int>(aleatoire.entier(12));
+          compte.m_anneeOuverture = 2000 + static_cast<int>(aleatoire.entier(26));
+        }
+    }
+}
+
+void ajouterLigne (std::string& p_tampon, const char* p_texte)
+{
+  p_tampon += p_texte;
+  p_tampon += '\n';
+}
+
+void ajouterEntier (std::string& p_tampon, std::uint64_t p_valeur)
+{
+  char chiffres[24];
+  char* fin = std::to_chars(chiffres, chiffres + sizeof(chiffres), p_valeur).ptr;
+  *fin++ = '\n';
+  p_tampon.append(chiffres, fin);
+}
+
+/**
+ * \brief Écrit un montant en centièmes avec deux décimales, par exemple -1234.05
+ */
+void ajouterCentiemes (std::string& p_tampon, std::int64_t p_centiemes)
+{
+  char chiffres[32];
+  char* debut = chiffres;
+  if (p_centiemes < 0)
+    {
+      *debut++ = '-';
+      p_centiemes = -p_centiemes;
+    }
+  char* fin = std::to_chars(debut, chiffres + sizeof(chiffres), p_centiemes / 100).ptr;
+  *fin++ = '.';
+  *fin++ = static_cast<char>('0' + p_centiemes / 10 % 10);
+  *fin++ = static_cast<char>('0' + p_centiemes % 10);
+  *fin++ = '\n';
+  p_tampon.append(chiffres, fin);
+}
+
+void ajouterDate (std::string& p_tampon, int p_jour, int p_mois, int p_annee)
+{
+  const char date[] = {static_cast<char>('0' + p_jour / 10), static_cast<char>('0' + p_jour % 10), ' ',
+                       static_cast<char>('0' + p_mois / 10), static_cast<char>('0' + p_mois % 10), ' ',
+                       static_cast<char>('0' + p_annee / 1000), static_cast<char>('0' + p_annee / 100 % 10),
+                       static_cast<char>('0' + p_annee / 10 % 10), static_cast<char>('0' + p_annee % 10), '\n'};
+  p_tampon.append(date, sizeof(date));
+}
+
+void ecrireTout (int p_descripteur, const std::string& p_tampon)
+{
+  const char* donnees = p_tampon.data();
+  std::size_t reste = p_tampon.size();
+  while (reste > 0)
+    {
+      ssize_t ecrits = ::write(p_descripteur, donnees, reste);
+      if (ecrits < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+          throw std::runtime_error("Erreur d'écriture lors de la génération");
+        }
+      donnees += ecrits;
+      reste -= static_cast<std::size_t>(ecrits);
+    }
+}
+} // namespace
+
+
+/**
+ * \brief Constructeur des paramètres par défaut: 1000 clients de 1 à 8 comptes, moitié chèque
+ */
+ParametresGeneration::ParametresGeneration()
+  : m_graine(1), m_nbrClients(1000), m_distributionComptes(DistributionComptes::UNIFORME),
+  m_nbrComptesMin(1), m_nbrComptesMax(8), m_nbrComptesMoyen(4.0), m_proportionCheques(0.5),
+  m_soldeMedian(2500.0), m_soldeDispersion(1.0), m_proportionDecouverts(0.2),
+  m_tauxEpargneMin(0.5), m_tauxEpargneMax(3.0), m_poidsPaliers{0.4, 0.3, 0.2, 0.1} { }
+
+
+/**
+ * \brief Constructeur du générateur
+ * \param[in] p_parametres les paramètres du jeu de données
+ * \pre m_nbrComptesMin <= m_nbrComptesMax et les numéros de compte tiennent dans un unsigned
+ * \pre les proportions sont dans [0, 1]
+ * \pre m_soldeMedian > 0 et m_soldeDispersion >= 0
+ * \pre 0.1 <= m_tauxEpargneMin <= m_tauxEpargneMax <= 3.5
+ * \pre les poids des paliers sont positifs ou nuls, et leur somme est positive
+ */
+GenerateurClients::GenerateurClients(const ParametresGeneration& p_parametres) : m_parametres(p_parametres)
+{
+  PRECONDITION (p_parametres.m_nbrComptesMin <= p_parametres.m_nbrComptesMax);
+  PRECONDITION (p_parametres.m_nbrComptesMax <= 100000000u);
+  PRECONDITION (p_parametres.m_proportionCheques >= 0.0 && p_parametres.m_proportionCheques <= 1.0);
+  PRECONDITION (p_parametres.m_proportionDecouverts >= 0.0 && p_parametres.m_proportionDecouverts <= 1.0);
+  PRECONDITION (p_parametres.m_soldeMedian > 0.0 && p_parametres.m_soldeDispersion >= 0.0);
+  PRECONDITION (p_parametres.m_tauxEpargneMin >= TAUX_EPARGNE_MIN && p_parametres.m_tauxEpargneMax <= TAUX_EPARGNE_MAX);
+  PRECONDITION (p_parametres.m_tauxEpargneMin <= p_parametres.m_tauxEpargneMax);
+  PRECONDITION (std::all_of(std::begin(p_parametres.m_poidsPaliers), std::end(p_parametres.m_poidsPaliers),
+                            [] (double p_poids) { return p_poids >= 0.0; }));
+  PRECONDITION (p_parametres.m_poidsPaliers[0] + p_parametres.m_poidsPaliers[1]
+                + p_parametres.m_poidsPaliers[2] + p_parametres.m_poidsPaliers[3] > 0.0);
+}
+
+
+/**
+ * \brief Retourne les paramètres du générateur
+ * \return une référence constante sur les paramètres
+ */
+const ParametresGeneration& GenerateurClients::reqParametres() const
+{
+  return m_parametres;
+}
+
+
+/**
+ * \brief Ajoute à un tampon le texte du client de rang p_rang
+ *        Le bloc d'un client de rang non nul est précédé de la ligne vide qui le sépare du précédent.
+ * \param[in] p_rang le rang du client, de 0 à m_nbrClients - 1
+ * \param[in,out] p_tampon le tampon auquel le texte est ajouté
+ * \return le nombre de comptes du client
+ */
+unsigned GenerateurClients::genererTexte(std::uint64_t p_rang, std::string& p_tampon) const
+{
+  ClientGenere client;
+  tirerClient(m_parametres, p_rang, client);
+
+  if (p_rang > 0)
+    {
+      p_tampon += '\n';
+    }
+  ajouterLigne(p_tampon, client.m_nom);
+  ajouterLigne(p_tampon, client.m_prenom);
+  ajouterDate(p_tampon, client.m_jourNaissance, client.m_moisNaissance, client.m_anneeNaissance);
+  ajouterLigne(p_tampon, client.m_telephone);
+  ajouterEntier(p_tampon, client.m_noFolio);
+  for (const CompteGenere& compte : client.m_comptes)
+    {
+      p_tampon += compte.m_estCheque ? "cheque\n" : "epargne\n";
+      ajouterEntier(p_tampon, compte.m_noCompte);
+      ajouterCentiemes(p_tampon, compte.m_tauxCentiemes);
+      ajouterCentiemes(p_tampon, compte.m_soldeCentimes);
+      ajouterLigne(p_tampon, compte.m_description);
+      if (compte.m_estCheque)
+        {
+          ajouterEntier(p_tampon, compte.m_nbrTransactions);
+          ajouterCentiemes(p_tampon, compte.m_tauxMinimumCentiemes);
+        }
+      else
+        {
+          p_tampon += "0\n";
+          ajouterDate(p_tampon, compte.m_jourOuverture, compte.m_moisOuverture, compte.m_anneeOuverture);
+        }
+    }
+  return static_cast<unsigned>(client.m_comptes.size());
+}
+
+
+/**
+ * \brief Construit le client de rang p_rang et ses comptes, identiques à ceux de genererTexte()
+ * \param[in] p_rang le rang du client, de 0 à m_nbrClients - 1
+ * \return le client construit
+ */
+Client GenerateurClients::genererClient(std::uint64_t p_rang) const
+{
+  ClientGenere genere;
+  tirerClient(m_parametres, p_rang, genere);
+
+  Client client(genere.m_noFolio, genere.m_nom, genere.m_prenom,
+                util::Date(genere.m_jourNaissance, genere.m_moisNaissance, genere.m_anneeNaissance),
+                genere.m_telephone);
+  std::vector<std::unique_ptr<Compte>> comptes;
+  comptes.reserve(genere.m_comptes.size());
+  for (const CompteGenere& compte : genere.m_comptes)
+    {
+      if (compte.m_estCheque)
+        {
+          comptes.push_back(std::make_unique<Cheque>(compte.m_noCompte, compte.m_soldeCentimes / 100.0,
+                                                     compte.m_tauxCentiemes / 100.0, compte.m_nbrTransactions,
+                                                     compte.m_tauxMinimumCentiemes / 100.0, compte.m_description));
+        }
+      else
+        {
+          comptes.push_back(std::make_unique<Epargne>(compte.m_noCompte, compte.m_soldeCentimes / 100.0,
+                                                      compte.m_tauxCentiemes / 100.0, compte.m_description,
+                                                      util::Date(compte.m_jourOuverture, compte.m_moisOuverture,
+                                                                 compte.m_anneeOuverture)));
+        }
+    }
+  client.essayerAjouterComptes(std::move(comptes));
+  return client;
+}
+
+
+/**
+ * \brief Écrit le jeu de données complet en texte dans un descripteur
+ *        Les clients sont générés par lots de CLIENTS_PAR_LOT, un lot par fil à la fois,
+ *        et les lots sont écrits dans l'ordre: la sortie est identique quel que soit p_nbFils.
+ * \param[in] p_descripteur le descripteur, qui n'est pas fermé
+ * \param[in] p_nbFils le nombre de fils à utiliser, 0 pour un fil par coeur
+ * \return le nombre de comptes écrits
+ * \exception std::runtime_error si l'écriture échoue
+ */
+std::uint64_t GenerateurClients::ecrireTexte(int p_descripteur, unsigned p_nbFils) const
+{
+  const unsigned nbFils = p_nbFils > 0 ? p_nbFils : std::max(1u, std::thread::hardware_concurrency());
+  const std::uint64_t nbrLots = (m_parametres.m_nbrClients + CLIENTS_PAR_LOT - 1) / CLIENTS_PAR_LOT;
+  std::vector<std::string> tampons(nbFils);
+  std::vector<std::uint64_t> nbrComptes(nbFils);
+  std::uint64_t total = 0;
+
+  auto generer = [&] (std::uint64_t p_lot, std::size_t p_fil)
+    {
+      std::string& tampon = tampons[p_fil];
+      tampon.clear();
+      nbrComptes[p_fil] = 0;
+      const std::uint64_t fin = std::min(m_parametres.m_nbrClients, (p_lot + 1) * CLIENTS_PAR_LOT);
+      for (std::uint64_t rang = p_lot * CLIENTS_PAR_LOT; rang < fin; rang++)
+        {
+          nbrComptes[p_fil] += genererTexte(rang, tampon);
+        }
+    };
+
+  for (std::uint64_t premierLot = 0; premierLot < nbrLots; premierLot += nbFils)
+    {
+      const std::size_t nbLotsTour = static_cast<std::size_t>(std::min<std::uint64_t>(nbFils, nbrLots - premierLot));
+      util::GroupeFils fils;
+      for (std::size_t i = 1; i < nbLotsTour; i++)
+        {
+          fils.lancer([&generer, premierLot, i] { generer(premierLot + i, i); });
+        }
+      generer(premierLot, 0);
+      fils.joindre();
+      for (std::size_t i = 0; i < nbLotsTour; i++)
+        {
+          ecrireTout(p_descripteur, tampons[i]);
+          total += nbrComptes[i];
+        }
+    }
+  return total;
+}
+
+
+/**
+ * \brief Écrit le jeu de données complet au format FormatExport::COLONNES_BINAIRE
+ * \param[in] p_descripteur le descripteur, qui n'est pas fermé
+ * \return le nombre de comptes écrits
+ * \exception std::runtime_error si l'écriture échoue
+ */
+std::uint64_t GenerateurClients::ecrireColonnes(int p_descripteur) const
+{
+  Exportateur exportateur(p_descripteur, FormatExport::COLONNES_BINAIRE);
+  std::uint64_t total = 0;
+  for (std::uint64_t rang = 0; rang < m_parametres.m_nbrClients; rang++)
+    {
+      Client client = genererClient(rang);
+      total += client.reqNbrComptes();
+      exportateur.exporterClient(client);
+    }
+  exportateur.terminer();
+  return total;
+}
+
+} // namespace bancaire
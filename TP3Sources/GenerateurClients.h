@@ -0,0 +1,105 @@
+/**
+ * \file GenerateurClients.h
+ * \brief Fichier qui contient l'interface de la classe GenerateurClients qui produit des jeux de données synthétiques.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef GENERATEURCLIENTS_H
+#define GENERATEURCLIENTS_H
+
+#include <string>
+#include <cstdint>
+
+#include "Client.h"
+
+namespace bancaire
+{
+/**
+ * \brief Loi du nombre de comptes par client
+ *
+ *        UNIFORME:    chaque nombre de [m_nbrComptesMin, m_nbrComptesMax] est équiprobable
+ *        GEOMETRIQUE: m_nbrComptesMin plus une variable géométrique de moyenne
+ *                     m_nbrComptesMoyen - m_nbrComptesMin, tronquée à m_nbrComptesMax;
+ *                     beaucoup de petits clients et quelques gros portefeuilles
+ */
+enum class DistributionComptes
+{
+  UNIFORME,
+  GEOMETRIQUE
+};
+
+
+/**
+ * \struct ParametresGeneration
+ * \brief Paramètres d'un jeu de données synthétique; le constructeur donne des valeurs réalistes.
+ *
+ *              Les soldes suivent une loi log-normale de médiane m_soldeMedian et
+ *              d'écart type m_soldeDispersion sur le logarithme; une proportion
+ *              m_proportionDecouverts des comptes chèque sont à découvert. Les taux des
+ *              comptes épargne sont uniformes dans [m_tauxEpargneMin, m_tauxEpargneMax].
+ *              Le nombre de transactions d'un compte chèque tombe dans l'un des paliers
+ *              0-10, 11-25, 26-35 et 36-40 selon les poids m_poidsPaliers, puis est
+ *              uniforme dans le palier.
+ *              Au-delà de 9000 clients (m_nbrClients), les numéros de folio se répètent,
+ *              voir GenerateurClients.
+ */
+struct ParametresGeneration
+{
+  ParametresGeneration();
+
+  std::uint64_t m_graine;
+  std::uint64_t m_nbrClients;
+  DistributionComptes m_distributionComptes;
+  unsigned m_nbrComptesMin;
+  unsigned m_nbrComptesMax;
+  double m_nbrComptesMoyen;
+  double m_proportionCheques;
+  double m_soldeMedian;
+  double m_soldeDispersion;
+  double m_proportionDecouverts;
+  double m_tauxEpargneMin;
+  double m_tauxEpargneMax;
+  double m_poidsPaliers[4];
+};
+
+
+/**
+ * \class GenerateurClients
+ * \brief Génère de façon déterministe des clients et leurs comptes pour les essais de charge.
+ *
+ *              Chaque client est entièrement déterminé par la graine et son rang: il peut
+ *              être produit isolément, dans n'importe quel ordre et sur n'importe quel fil,
+ *              et la sortie ne dépend pas du nombre de fils utilisés. Le texte produit a le
+ *              format accepté par util::validerEnregistrements et LecteurClients: des blocs
+ *              clients, au format de validerFormatFichier, séparés par une ligne vide.
+ *              Les nombres sont écrits sans flux ni locale, avec deux décimales.
+ *              Le format binaire est celui de FormatExport::COLONNES_BINAIRE, produit par
+ *              un Exportateur à partir des mêmes clients.
+ *              Le client de rang r reçoit le folio 1000 + r % 9000: les folios valides ne
+ *              comptent que 9000 valeurs et se répètent au-delà de 9000 clients. Un jeu plus
+ *              grand ne peut donc pas être chargé en entier dans une Banque, qui n'accepte
+ *              qu'un client par folio; il convient aux traitements par fichier.
+ */
+class GenerateurClients
+{
+public:
+  explicit GenerateurClients(const ParametresGeneration& p_parametres);
+
+  const ParametresGeneration& reqParametres() const;
+  unsigned genererTexte(std::uint64_t p_rang, std::string& p_tampon) const;
+  Client genererClient(std::uint64_t p_rang) const;
+
+  std::uint64_t ecrireTexte(int p_descripteur, unsigned p_nbFils = 0) const;
+  std::uint64_t ecrireColonnes(int p_descripteur) const;
+
+  static const std::uint64_t CLIENTS_PAR_LOT = 16384;
+
+private:
+  ParametresGeneration m_parametres;
+};
+
+} // namespace bancaire
+
+#endif /* GENERATEURCLIENTS_H */
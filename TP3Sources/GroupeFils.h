@@ -0,0 +1,103 @@
+/**
+ * \file GroupeFils.h
+ * \brief Fichier qui contient la classe GroupeFils, des fils d'exécution toujours joints.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef GROUPEFILS_H
+#define GROUPEFILS_H
+
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+/**
+ * \class GroupeFils
+ * \brief Fils d'exécution lancés ensemble et joints avant la destruction du groupe.
+ *
+ *              Un std::thread encore joignable à sa destruction appelle std::terminate.
+ *              Le destructeur joint donc les fils lancés: une exception lancée par le
+ *              lancement d'un fil ou par le fil appelant remonte normalement. Le groupe
+ *              se déclare après les données que les fils utilisent, afin d'être détruit
+ *              avant elles.
+ *
+ *              La première exception lancée dans un fil est conservée et relancée par
+ *              joindre().
+ */
+class GroupeFils
+{
+public:
+  GroupeFils () = default;
+  ~GroupeFils ()
+  {
+    attendre();
+  }
+
+  GroupeFils (const GroupeFils&) = delete;
+  GroupeFils& operator= (const GroupeFils&) = delete;
+
+  /**
+   * \brief Lance p_tache dans un nouveau fil
+   * \param[in] p_tache la tâche, appelée sans argument
+   * \exception std::system_error si le fil ne peut être créé
+   */
+  template <typename Tache>
+  void lancer (Tache p_tache)
+  {
+    m_fils.emplace_back([this, p_tache] () mutable
+      {
+        try
+          {
+            p_tache();
+          }
+        catch (...)
+          {
+            std::lock_guard<std::mutex> verrou(m_mutex);
+            if (!m_erreur)
+              {
+                m_erreur = std::current_exception();
+              }
+          }
+      });
+  }
+
+  /**
+   * \brief Joint tous les fils lancés, puis relance la première exception d'un fil
+   */
+  void joindre ()
+  {
+    attendre();
+    if (m_erreur)
+      {
+        std::exception_ptr erreur = m_erreur;
+        m_erreur = nullptr;
+        std::rethrow_exception(erreur);
+      }
+  }
+
+private:
+  void attendre ()
+  {
+    for (auto& fil : m_fils)
+      {
+        if (fil.joinable())
+          {
+            fil.join();
+          }
+      }
+    m_fils.clear();
+  }
+
+  std::vector<std::thread> m_fils;
+  std::mutex m_mutex;
+  std::exception_ptr m_erreur;
+};
+
+} // namespace util
+
+#endif /* GROUPEFILS_H */
@@ -0,0 +1,414 @@
+/**
+ * \file IndexComptes.cpp
+ * \brief Implémentation de la classe IndexComptes
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "IndexComptes.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+#include "ContratException.h"
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+const std::size_t NB_CHIFFRES_MAX = std::numeric_limits<unsigned>::digits10 + 1;
+
+/**
+ * \brief Ajoute à une permutation triée les rangs [p_debut, p_fin[, triés à part puis fusionnés
+ */
+template<typename Comparaison>
+void fusionnerRangs(std::vector<std::uint32_t>& p_permutation, std::size_t p_debut, std::size_t p_fin,
+                    Comparaison p_comparaison)
+{
+  const std::size_t milieu = p_permutation.size();
+  p_permutation.resize(milieu + p_fin - p_debut);
+  std::iota(p_permutation.begin() + milieu, p_permutation.end(), static_cast<std::uint32_t>(p_debut));
+  std::sort(p_permutation.begin() + milieu, p_permutation.end(), p_comparaison);
+  std::inplace_merge(p_permutation.begin(), p_permutation.begin() + milieu, p_permutation.end(), p_comparaison);
+}
+}
+
+
+/**
+ * \brief Indique si aucun critère n'est actif
+ * \return true si la recherche retient tous les comptes
+ */
+bool CritereRecherche::estVide() const
+{
+  return m_prefixeNumero.empty() && m_prefixeDescription.empty() && !m_soldeMin && !m_soldeMax;
+}
+
+
+/**
+ * \brief Construit l'index des comptes d'un client
+ * \param[in] p_client le client dont les comptes sont indexés
+ * \post l'index contient un rang par compte du client
+ */
+IndexComptes::IndexComptes(const Client& p_client)
+{
+  const std::size_t nbrComptes = p_client.reqNbrComptes();
+  m_numeros.reserve(nbrComptes);
+  m_soldes.reserve(nbrComptes);
+  m_descriptions.reserve(nbrComptes);
+  for (std::size_t i = 0; i < nbrComptes; i++)
+    {
+      const Compte& compte = p_client.reqCompte(i);
+      m_numeros.push_back(compte.reqNoCompte());
+      m_soldes.push_back(compte.reqSolde());
+      m_descriptions.push_back(normaliserDescription(compte.reqDescriptionVue()));
+    }
+  indexerDepuis(0);
+
+  POSTCONDITION (reqNbrComptes() == nbrComptes);
+}
+
+
+/**
+ * \brief Retourne le nombre de comptes indexés
+ * \return le nombre de comptes du client au moment de la construction
+ */
+std::size_t IndexComptes::reqNbrComptes() const
+{
+  return m_numeros.size();
+}
+
+
+/**
+ * \brief Indexe un compte ajouté à la fin des comptes du client
+ * \param[in] p_compte le compte ajouté, de rang reqNbrComptes()
+ * \post le compte est indexé au dernier rang
+ */
+void IndexComptes::ajouter(const Compte& p_compte)
+{
+  const std::uint32_t rang = static_cast<std::uint32_t>(reqNbrComptes());
+  m_numeros.push_back(p_compte.reqNoCompte());
+  m_soldes.push_back(p_compte.reqSolde());
+  m_descriptions.push_back(normaliserDescription(p_compte.reqDescriptionVue()));
+
+  m_parNumero.insert(std::upper_bound(m_parNumero.begin(), m_parNumero.end(), rang,
+                                      [this] (std::uint32_t a, std::uint32_t b) { return m_numeros[a] < m_numeros[b]; }),
+                     rang);
+  m_parDescription.insert(std::upper_bound(m_parDescription.begin(), m_parDescription.end(), rang,
+                                           [this] (std::uint32_t a, std::uint32_t b) { return m_descriptions[a] < m_descriptions[b]; }),
+                          rang);
+  m_parSolde.insert(std::upper_bound(m_parSolde.begin(), m_parSolde.end(), rang,
+                                     [this] (std::uint32_t a, std::uint32_t b) { return m_soldes[a] < m_soldes[b]; }),
+                    rang);
+
+  POSTCONDITION (reqNbrComptes() == rang + 1u);
+}
+
+
+/**
+ * \brief Indexe un lot de comptes ajoutés à la fin des comptes du client
+ *        Le lot est trié à part puis fusionné avec l'index existant, ce qui évite
+ *        le déplacement de toute la permutation à chaque compte.
+ * \param[in] p_comptes les comptes ajoutés, dans l'ordre de leurs rangs à partir de reqNbrComptes()
+ * \post les comptes sont indexés aux derniers rangs
+ */
+void IndexComptes::ajouterComptes(const std::vector<std::unique_ptr<Compte>>& p_comptes)
+{
+  const std::size_t debut = reqNbrComptes();
+  for (const std::unique_ptr<Compte>& compte : p_comptes)
+    {
+      m_numeros.push_back(compte->reqNoCompte());
+      m_soldes.push_back(compte->reqSolde());
+      m_descriptions.push_back(normaliserDescription(compte->reqDescriptionVue()));
+    }
+  indexerDepuis(debut);
+
+  POSTCONDITION (reqNbrComptes() == debut + p_comptes.size());
+}
+
+
+/**
+ * \brief Retire un compte de l'index; les comptes suivants reculent d'un rang, comme dans le client
+ * \param[in] p_rang le rang du compte supprimé
+ * \pre p_rang < reqNbrComptes()
+ */
+void IndexComptes::retirer(std::uint32_t p_rang)
+{
+  PRECONDITION (p_rang < reqNbrComptes());
+
+  m_numeros.erase(m_numeros.begin() + p_rang);
+  m_soldes.erase(m_soldes.begin() + p_rang);
+  m_descriptions.erase(m_descriptions.begin() + p_rang);
+  for (std::vector<std::uint32_t>* permutation : {&m_parNumero, &m_parDescription, &m_parSolde})
+    {
+      permutation->erase(std::remove(permutation->begin(), permutation->end(), p_rang), permutation->end());
+      for (std::uint32_t& rang : *permutation)
+        {
+          rang -= rang > p_rang;
+        }
+    }
+
+  POSTCONDITION (m_parNumero.size() == reqNbrComptes());
+}
+
+
+/**
+ * \brief Ajoute aux trois permutations les rangs à partir de p_debut, déjà copiés dans les colonnes
+ */
+void IndexComptes::indexerDepuis(std::size_t p_debut)
+{
+  const std::size_t fin = reqNbrComptes();
+  fusionnerRangs(m_parNumero, p_debut, fin,
+                 [this] (std::uint32_t a, std::uint32_t b) { return m_numeros[a] < m_numeros[b]; });
+  fusionnerRangs(m_parDescription, p_debut, fin,
+                 [this] (std::uint32_t a, std::uint32_t b) { return m_descriptions[a] < m_descriptions[b]; });
+  fusionnerRangs(m_parSolde, p_debut, fin,
+                 [this] (std::uint32_t a, std::uint32_t b) { return m_soldes[a] < m_soldes[b]; });
+}
+
+
+/**
+ * \brief Retrouve par fouille dichotomique le rang d'un compte
+ * \param[in] p_noCompte le numéro du compte recherché
+ * \return le rang du compte, std::nullopt s'il est absent
+ */
+std::optional<std::uint32_t> IndexComptes::chercherNumero(unsigned p_noCompte) const
+{
+  Iterateur iter = std::partition_point(m_parNumero.begin(), m_parNumero.end(),
+                                        [&] (std::uint32_t r) { return m_numeros[r] < p_noCompte; });
+  if (iter == m_parNumero.end() || m_numeros[*iter] != p_noCompte)
+    {
+      return std::nullopt;
+    }
+  return *iter;
+}
+
+
+/**
+ * \brief Recherche les comptes qui satisfont tous les critères
+ * \param[in] p_critere les critères de la recherche
+ * \return les rangs des comptes retenus, en ordre croissant, tous les rangs si aucun critère n'est actif
+ */
+std::vector<std::uint32_t> IndexComptes::rechercher(const CritereRecherche& p_critere) const
+{
+  std::vector<std::uint32_t> resultats;
+  if (p_critere.estVide())
+    {
+      resultats.resize(reqNbrComptes());
+      std::iota(resultats.begin(), resultats.end(), 0);
+      return resultats;
+    }
+
+  // le critère dont la plage compte le moins de candidats guide le parcours
+  const std::string prefixeDescription = normaliserDescription(p_critere.m_prefixeDescription);
+  std::vector<Plage> candidats(1, Plage(m_parNumero.begin(), m_parNumero.end()));
+  std::size_t nbrCandidats = reqNbrComptes();
+  auto retenirSiPlusPetit = [&] (const std::vector<Plage>& p_plages)
+    {
+      std::size_t nbr = 0;
+      for (const Plage& plage : p_plages)
+        {
+          nbr += plage.second - plage.first;
+        }
+      if (nbr < nbrCandidats)
+        {
+          candidats = p_plages;
+          nbrCandidats = nbr;
+        }
+    };
+
+  if (!p_critere.m_prefixeNumero.empty())
+    {
+      retenirSiPlusPetit(plagesNumero(p_critere.m_prefixeNumero));
+    }
+  if (!prefixeDescription.empty())
+    {
+      retenirSiPlusPetit(std::vector<Plage>(1, plageDescription(prefixeDescription)));
+    }
+  if (p_critere.m_soldeMin || p_critere.m_soldeMax)
+    {
+      retenirSiPlusPetit(std::vector<Plage>(1, plageSolde(p_critere)));
+    }
+
+  for (const Plage& plage : candidats)
+    {
+      for (Iterateur iter = plage.first; iter != plage.second; ++iter)
+        {
+          if (correspond(*iter, p_critere, prefixeDescription))
+            {
+              resultats.push_back(*iter);
+            }
+        }
+    }
+
+  // remise en ordre des rangs: un marquage linéaire est moins coûteux qu'un tri lorsque les résultats sont nombreux
+  if (resultats.size() * 16 > reqNbrComptes())
+    {
+      std::vector<bool> marques(reqNbrComptes());
+      for (std::uint32_t rang : resultats)
+        {
+          marques[rang] = true;
+        }
+      resultats.clear();
+      for (std::uint32_t rang = 0; rang < marques.size(); rang++)
+        {
+          if (marques[rang])
+            {
+              resultats.push_back(rang);
+            }
+        }
+    }
+  else
+    {
+      std::sort(resultats.begin(), resultats.end());
+    }
+  return resultats;
+}
+
+
+/**
+ * \brief Normalise une description pour la recherche: lettres ASCII en minuscules
+ * \param[in] p_description la description d'un compte ou un préfixe recherché
+ * \return la description normalisée
+ */
+std::string IndexComptes::normaliserDescription(std::string_view p_description)
+{
+  std::string normalisee(p_description);
+  for (char& c : normalisee)
+    {
+      if (c >= 'A' && c <= 'Z')
+        {
+          c = c - 'A' + 'a';
+        }
+    }
+  return normalisee;
+}
+
+
+/**
+ * \brief Délimite les numéros qui débutent par un préfixe de chiffres
+ *        Pour chaque nombre de chiffres possible, ces numéros forment un intervalle
+ *        contigu, par exemple [12, 12], [120, 129], [1200, 1299], etc. pour "12".
+ * \return une plage de m_parNumero par intervalle, aucune si le préfixe n'est pas formé de chiffres
+ */
+std::vector<IndexComptes::Plage> IndexComptes::plagesNumero(const std::string& p_prefixe) const
+{
+  std::vector<Plage> plages;
+  if (p_prefixe.size() > NB_CHIFFRES_MAX
+      || !std::all_of(p_prefixe.begin(), p_prefixe.end(), [] (char c) { return c >= '0' && c <= '9'; }))
+    {
+      return plages;
+    }
+
+  auto plageEntre = [this] (std::uint64_t p_min, std::uint64_t p_max)
+    {
+      Iterateur debut = std::partition_point(m_parNumero.begin(), m_parNumero.end(),
+                                             [&] (std::uint32_t r) { return m_numeros[r] < p_min; });
+      Iterateur fin = std::partition_point(debut, m_parNumero.end(),
+                                           [&] (std::uint32_t r) { return m_numeros[r] <= p_max; });
+      return Plage(debut, fin);
+    };
+
+  std::uint64_t valeur = std::stoull(p_prefixe);
+  if (p_prefixe[0] == '0')
+    {
+      // seul le numéro 0 s'écrit avec un zéro initial
+      if (p_prefixe.size() == 1)
+        {
+          plages.push_back(plageEntre(0, 0));
+        }
+      return plages;
+    }
+
+  std::uint64_t largeur = 1;
+  for (std::size_t nbChiffres = p_prefixe.size(); nbChiffres <= NB_CHIFFRES_MAX; nbChiffres++)
+    {
+      std::uint64_t min = valeur * largeur;
+      if (min > std::numeric_limits<unsigned>::max())
+        {
+          break;
+        }
+      plages.push_back(plageEntre(min, (valeur + 1) * largeur - 1));
+      largeur *= 10;
+    }
+  return plages;
+}
+
+
+/**
+ * \brief Délimite les descriptions normalisées qui débutent par un préfixe normalisé
+ */
+IndexComptes::Plage IndexComptes::plageDescription(const std::string& p_prefixe) const
+{
+  Iterateur debut = std::partition_point(m_parDescription.begin(), m_parDescription.end(),
+                                         [&] (std::uint32_t r) { return m_descriptions[r] < p_prefixe; });
+  Iterateur fin = std::partition_point(debut, m_parDescription.end(),
+                                       [&] (std::uint32_t r)
+                                       {
+                                         return std::string_view(m_descriptions[r]).substr(0, p_prefixe.size()) == p_prefixe;
+                                       });
+  return Plage(debut, fin);
+}
+
+
+/**
+ * \brief Délimite les soldes compris entre les bornes du critère, bornes incluses
+ */
+IndexComptes::Plage IndexComptes::plageSolde(const CritereRecherche& p_critere) const
+{
+  Iterateur debut = m_parSolde.begin();
+  Iterateur fin = m_parSolde.end();
+  if (p_critere.m_soldeMin)
+    {
+      debut = std::partition_point(debut, fin, [&] (std::uint32_t r) { return m_soldes[r] < *p_critere.m_soldeMin; });
+    }
+  if (p_critere.m_soldeMax)
+    {
+      fin = std::partition_point(debut, fin, [&] (std::uint32_t r) { return m_soldes[r] <= *p_critere.m_soldeMax; });
+    }
+  return Plage(debut, fin);
+}
+
+
+/**
+ * \brief Vérifie tous les critères actifs sur les copies d'un rang
+ */
+bool IndexComptes::correspond(std::uint32_t p_rang, const CritereRecherche& p_critere,
+                              const std::string& p_prefixeDescription) const
+{
+  if (!p_critere.m_prefixeNumero.empty() && !numeroDebutePar(m_numeros[p_rang], p_critere.m_prefixeNumero))
+    {
+      return false;
+    }
+  if (m_descriptions[p_rang].compare(0, p_prefixeDescription.size(), p_prefixeDescription) != 0)
+    {
+      return false;
+    }
+  if (p_critere.m_soldeMin && m_soldes[p_rang] < *p_critere.m_soldeMin)
+    {
+      return false;
+    }
+  return !(p_critere.m_soldeMax && m_soldes[p_rang] > *p_critere.m_soldeMax);
+}
+
+
+/**
+ * \brief Indique si un numéro, écrit en base 10, débute par un préfixe de chiffres
+ */
+bool IndexComptes::numeroDebutePar(unsigned p_numero, const std::string& p_prefixe)
+{
+  char tampon[NB_CHIFFRES_MAX];
+  char* fin = tampon + NB_CHIFFRES_MAX;
+  char* debut = fin;
+  do
+    {
+      *--debut = static_cast<char>('0' + p_numero % 10);
+      p_numero /= 10;
+    }
+  while (p_numero != 0);
+  return std::string_view(debut, fin - debut).substr(0, p_prefixe.size()) == p_prefixe;
+}
+
+} // namespace bancaire
@@ -0,0 +1,93 @@
+/**
+ * \file IndexComptes.h
+ * \brief Fichier qui contient l'interface de la classe IndexComptes qui sert à la recherche rapide des comptes d'un client.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef INDEXCOMPTES_H
+#define INDEXCOMPTES_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <cstdint>
+
+#include "Client.h"
+
+namespace bancaire
+{
+/**
+ * \struct CritereRecherche
+ * \brief Critères d'une recherche de comptes; un critère vide est ignoré.
+ *
+ *              m_prefixeNumero retient les comptes dont le numéro, écrit en base 10,
+ *              débute par ces chiffres; m_prefixeDescription ceux dont la description
+ *              débute par ce texte, sans égard à la casse des lettres ASCII;
+ *              m_soldeMin et m_soldeMax bornent le solde, bornes incluses.
+ */
+struct CritereRecherche
+{
+  std::string m_prefixeNumero;
+  std::string m_prefixeDescription;
+  std::optional<double> m_soldeMin;
+  std::optional<double> m_soldeMax;
+
+  bool estVide() const;
+};
+
+
+/**
+ * \class IndexComptes
+ * \brief Index en mémoire des comptes d'un client par numéro, description et solde.
+ *
+ *              L'index copie, par rang, le numéro, le solde et la description en minuscules
+ *              de chaque compte, et conserve trois permutations des rangs triées selon ces
+ *              clés. Une recherche délimite par fouille dichotomique la plage de chaque
+ *              critère, parcourt la plus petite et vérifie les autres critères sur les
+ *              copies: son coût dépend du nombre de candidats, non du nombre de comptes.
+ *              L'index reflète le client au moment de sa construction; un ajout ou une
+ *              suppression de compte doit lui être rapporté avec ajouter() ou retirer(),
+ *              dont le coût est linéaire mais sans tri ni allocation de chaîne par compte.
+ *              Un lot de comptes ajouté d'un coup avec ajouterComptes() est trié à part
+ *              puis fusionné, en un seul passage linéaire pour tout le lot.
+ */
+class IndexComptes
+{
+public:
+  explicit IndexComptes(const Client& p_client);
+
+  std::size_t reqNbrComptes() const;
+  void ajouter(const Compte& p_compte);
+  void ajouterComptes(const std::vector<std::unique_ptr<Compte>>& p_comptes);
+  void retirer(std::uint32_t p_rang);
+  std::optional<std::uint32_t> chercherNumero(unsigned p_noCompte) const;
+  std::vector<std::uint32_t> rechercher(const CritereRecherche& p_critere) const;
+
+  static std::string normaliserDescription(std::string_view p_description);
+
+private:
+  typedef std::vector<std::uint32_t>::const_iterator Iterateur;
+  typedef std::pair<Iterateur, Iterateur> Plage;
+
+  std::vector<Plage> plagesNumero(const std::string& p_prefixe) const;
+  Plage plageDescription(const std::string& p_prefixe) const;
+  Plage plageSolde(const CritereRecherche& p_critere) const;
+  bool correspond(std::uint32_t p_rang, const CritereRecherche& p_critere, const std::string& p_prefixeDescription) const;
+  static bool numeroDebutePar(unsigned p_numero, const std::string& p_prefixe);
+  void indexerDepuis(std::size_t p_debut);
+
+  std::vector<unsigned> m_numeros;
+  std::vector<double> m_soldes;
+  std::vector<std::string> m_descriptions;
+  std::vector<std::uint32_t> m_parNumero;
+  std::vector<std::uint32_t> m_parDescription;
+  std::vector<std::uint32_t> m_parSolde;
+};
+
+} // namespace bancaire
+
+#endif /* INDEXCOMPTES_H */
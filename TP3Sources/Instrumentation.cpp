@@ -0,0 +1,436 @@
+/**
+ * \file Instrumentation.cpp
+ * \brief Implémentation des classes HistogrammeLatence et Instrumentation
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "Instrumentation.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "ContratException.h"
+
+using namespace std;
+namespace util
+{
+namespace
+{
+const std::size_t NB_POINTS = static_cast<std::size_t>(PointMesure::NB_POINTS);
+const char* const NOMS_POINTS[NB_POINTS] = {"ajouterCompte", "supprimerCompte", "reqReleves",
+                                            "calculerInteret", "validationFichier", "constructionClient"};
+const double PERCENTILES_RAPPORT[] = {50.0, 90.0, 99.0, 99.9};
+
+/**
+ * \brief Incrémente un compteur dont le fil courant est le seul écrivain, sans instruction verrouillée
+ */
+inline void ajouter (std::atomic<std::uint64_t>& p_compteur, std::uint64_t p_valeur)
+{
+  p_compteur.store(p_compteur.load(std::memory_order_relaxed) + p_valeur, std::memory_order_relaxed);
+}
+}
+
+
+/**
+ * \brief Bloc de compteurs d'un fil d'exécution, lisible par les autres fils
+ */
+struct Instrumentation::BlocFil
+{
+  std::atomic<std::uint64_t> m_cases[NB_POINTS][HistogrammeLatence::NB_CASES];
+  std::atomic<std::uint64_t> m_nbValeurs[NB_POINTS];
+  std::atomic<std::uint64_t> m_min[NB_POINTS];
+  std::atomic<std::uint64_t> m_max[NB_POINTS];
+  std::atomic<std::uint64_t> m_somme[NB_POINTS];
+
+  BlocFil ()
+  {
+    vider();
+  }
+
+  void vider ()
+  {
+    for (std::size_t point = 0; point < NB_POINTS; point++)
+      {
+        for (std::atomic<std::uint64_t>& nbValeurs : m_cases[point])
+          {
+            nbValeurs.store(0, std::memory_order_relaxed);
+          }
+        m_nbValeurs[point].store(0, std::memory_order_relaxed);
+        m_min[point].store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        m_max[point].store(0, std::memory_order_relaxed);
+        m_somme[point].store(0, std::memory_order_relaxed);
+      }
+  }
+
+  void enregistrer (std::size_t p_point, std::uint64_t p_valeur)
+  {
+    ajouter(m_cases[p_point][HistogrammeLatence::caseDe(p_valeur)], 1);
+    ajouter(m_nbValeurs[p_point], 1);
+    ajouter(m_somme[p_point], p_valeur);
+    if (p_valeur < m_min[p_point].load(std::memory_order_relaxed))
+      {
+        m_min[p_point].store(p_valeur, std::memory_order_relaxed);
+      }
+    if (p_valeur > m_max[p_point].load(std::memory_order_relaxed))
+      {
+        m_max[p_point].store(p_valeur, std::memory_order_relaxed);
+      }
+  }
+
+  /**
+   * \brief Ajoute le contenu d'un autre bloc; l'appelant doit être le seul écrivain des deux blocs
+   */
+  void absorber (const BlocFil& p_autre)
+  {
+    for (std::size_t point = 0; point < NB_POINTS; point++)
+      {
+        for (unsigned i = 0; i < HistogrammeLatence::NB_CASES; i++)
+          {
+            ajouter(m_cases[point][i], p_autre.m_cases[point][i].load(std::memory_order_relaxed));
+          }
+        ajouter(m_nbValeurs[point], p_autre.m_nbValeurs[point].load(std::memory_order_relaxed));
+        ajouter(m_somme[point], p_autre.m_somme[point].load(std::memory_order_relaxed));
+        m_min[point].store(std::min(m_min[point].load(std::memory_order_relaxed),
+                                    p_autre.m_min[point].load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        m_max[point].store(std::max(m_max[point].load(std::memory_order_relaxed),
+                                    p_autre.m_max[point].load(std::memory_order_relaxed)), std::memory_order_relaxed);
+      }
+  }
+};
+
+
+namespace
+{
+/**
+ * \brief Blocs des fils vivants et bloc commun des fils terminés
+ *        Le registre n'est jamais détruit: des fils peuvent se terminer pendant la
+ *        destruction des objets statiques.
+ */
+struct Registre
+{
+  std::mutex m_mutex;
+  std::vector<Instrumentation::BlocFil*> m_blocs;
+  Instrumentation::BlocFil m_blocTermines;
+};
+
+Registre& registre ()
+{
+  static Registre* instance = new Registre;
+  return *instance;
+}
+
+/**
+ * \brief Propriétaire du bloc d'un fil: l'inscrit au registre à la première mesure du
+ *        fil et le verse dans le bloc commun à la fin du fil
+ */
+struct PorteurBloc
+{
+  PorteurBloc () : m_bloc(new Instrumentation::BlocFil)
+  {
+    std::lock_guard<std::mutex> verrou(registre().m_mutex);
+    registre().m_blocs.push_back(m_bloc);
+  }
+
+  ~PorteurBloc ()
+  {
+    Registre& reg = registre();
+    std::lock_guard<std::mutex> verrou(reg.m_mutex);
+    reg.m_blocTermines.absorber(*m_bloc);
+    reg.m_blocs.erase(std::find(reg.m_blocs.begin(), reg.m_blocs.end(), m_bloc));
+    delete m_bloc;
+  }
+
+  Instrumentation::BlocFil* m_bloc;
+};
+
+thread_local PorteurBloc t_porteur;
+}
+
+
+/**
+ * \brief Constructeur d'un histogramme vide
+ */
+HistogrammeLatence::HistogrammeLatence()
+{
+  reinitialiser();
+}
+
+
+/**
+ * \brief Enregistre une valeur
+ * \param[in] p_nanosecondes la latence mesurée
+ * \post reqNbValeurs() est augmenté de 1
+ */
+void HistogrammeLatence::enregistrer(std::uint64_t p_nanosecondes)
+{
+  m_cases[caseDe(p_nanosecondes)]++;
+  m_nbValeurs++;
+  m_somme += p_nanosecondes;
+  m_min = std::min(m_min, p_nanosecondes);
+  m_max = std::max(m_max, p_nanosecondes);
+}
+
+
+/**
+ * \brief Ajoute les valeurs d'un autre histogramme
+ * \param[in] p_autre l'histogramme à fusionner
+ */
+void HistogrammeLatence::fusionner(const HistogrammeLatence& p_autre)
+{
+  for (unsigned i = 0; i < NB_CASES; i++)
+    {
+      m_cases[i] += p_autre.m_cases[i];
+    }
+  m_nbValeurs += p_autre.m_nbValeurs;
+  m_somme += p_autre.m_somme;
+  m_min = std::min(m_min, p_autre.m_min);
+  m_max = std::max(m_max, p_autre.m_max);
+}
+
+
+/**
+ * \brief Retire toutes les valeurs
+ * \post reqNbValeurs() == 0
+ */
+void HistogrammeLatence::reinitialiser()
+{
+  m_cases.fill(0);
+  m_nbValeurs = 0;
+  m_somme = 0;
+  m_min = std::numeric_limits<std::uint64_t>::max();
+  m_max = 0;
+}
+
+
+/**
+ * \brief Retourne le nombre de valeurs enregistrées
+ */
+std::uint64_t HistogrammeLatence::reqNbValeurs() const
+{
+  return m_nbValeurs;
+}
+
+
+/**
+ * \brief Retourne la plus petite valeur, 0 si l'histogramme est vide
+ */
+std::uint64_t HistogrammeLatence::reqMin() const
+{
+  return m_nbValeurs == 0 ? 0 : m_min;
+}
+
+
+/**
+ * \brief Retourne la plus grande valeur, 0 si l'histogramme est vide
+ */
+std::uint64_t HistogrammeLatence::reqMax() const
+{
+  return m_max;
+}
+
+
+/**
+ * \brief Retourne la moyenne exacte des valeurs, 0 si l'histogramme est vide
+ */
+double HistogrammeLatence::reqMoyenne() const
+{
+  return m_nbValeurs == 0 ? 0.0 : static_cast<double>(m_somme) / static_cast<double>(m_nbValeurs);
+}
+
+
+/**
+ * \brief Retourne une valeur sous laquelle se trouve un pourcentage des valeurs
+ *        Le résultat est la borne supérieure de la case du percentile, ramenée dans [min, max].
+ * \param[in] p_percentile le pourcentage, de 0 à 100
+ * \pre 0 <= p_percentile <= 100
+ * \return la valeur du percentile, 0 si l'histogramme est vide
+ */
+std::uint64_t HistogrammeLatence::reqPercentile(double p_percentile) const
+{
+  PRECONDITION (p_percentile >= 0.0 && p_percentile <= 100.0);
+  if (m_nbValeurs == 0)
+    {
+      return 0;
+    }
+  const std::uint64_t rang = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+    std::ceil(p_percentile / 100.0 * static_cast<double>(m_nbValeurs))));
+  std::uint64_t cumul = 0;
+  for (unsigned i = 0; i < NB_CASES; i++)
+    {
+      cumul += m_cases[i];
+      if (cumul >= rang)
+        {
+          return std::clamp(borneSuperieure(i), m_min, m_max);
+        }
+    }
+  return m_max;
+}
+
+
+/**
+ * \brief Retourne le nombre de valeurs d'une case
+ * \pre p_case < NB_CASES
+ */
+std::uint64_t HistogrammeLatence::reqNbValeursCase(unsigned p_case) const
+{
+  PRECONDITION (p_case < NB_CASES);
+  return m_cases[p_case];
+}
+
+
+/**
+ * \brief Retourne la plus petite valeur d'une case
+ * \pre p_case < NB_CASES
+ */
+std::uint64_t HistogrammeLatence::borneInferieure(unsigned p_case)
+{
+  PRECONDITION (p_case < NB_CASES);
+  if (p_case < 2 * NB_SOUS_CASES)
+    {
+      return p_case;
+    }
+  const unsigned decalage = p_case / NB_SOUS_CASES - 1;
+  return static_cast<std::uint64_t>(p_case % NB_SOUS_CASES + NB_SOUS_CASES) << decalage;
+}
+
+
+/**
+ * \brief Retourne la plus grande valeur d'une case
+ * \pre p_case < NB_CASES
+ */
+std::uint64_t HistogrammeLatence::borneSuperieure(unsigned p_case)
+{
+  PRECONDITION (p_case < NB_CASES);
+  return p_case + 1 == NB_CASES ? std::numeric_limits<std::uint64_t>::max() : borneInferieure(p_case + 1) - 1;
+}
+
+
+/**
+ * \brief Enregistre une mesure dans le bloc du fil courant
+ * \param[in] p_point le point de mesure
+ * \param[in] p_nanosecondes la latence mesurée
+ */
+void Instrumentation::enregistrer(PointMesure p_point, std::uint64_t p_nanosecondes)
+{
+  t_porteur.m_bloc->enregistrer(static_cast<std::size_t>(p_point), p_nanosecondes);
+}
+
+
+/**
+ * \brief Fusionne les mesures d'un point de tous les fils, vivants ou terminés
+ * \param[in] p_point le point de mesure
+ * \return l'histogramme fusionné
+ */
+HistogrammeLatence Instrumentation::reqHistogramme(PointMesure p_point)
+{
+  HistogrammeLatence histogramme;
+  Registre& reg = registre();
+  std::lock_guard<std::mutex> verrou(reg.m_mutex);
+  verser(reg.m_blocTermines, p_point, histogramme);
+  for (const BlocFil* bloc : reg.m_blocs)
+    {
+      verser(*bloc, p_point, histogramme);
+    }
+  return histogramme;
+}
+
+
+/**
+ * \brief Retourne le nombre de mesures d'un point, tous fils confondus
+ * \param[in] p_point le point de mesure
+ */
+std::uint64_t Instrumentation::reqNbAppels(PointMesure p_point)
+{
+  return reqHistogramme(p_point).reqNbValeurs();
+}
+
+
+/**
+ * \brief Produit un rapport texte des mesures, une ligne par point mesuré
+ *        Les latences sont en nanosecondes.
+ * \return le rapport, qui n'a que la ligne d'en-tête si rien n'a été mesuré
+ */
+std::string Instrumentation::rapport()
+{
+  std::ostringstream os;
+  os << std::left << std::setw(20) << "point" << std::right << std::setw(12) << "appels"
+     << std::setw(12) << "min" << std::setw(12) << "moyenne";
+  for (double percentile : PERCENTILES_RAPPORT)
+    {
+      std::ostringstream titre;
+      titre << 'p' << percentile;
+      os << std::setw(12) << titre.str();
+    }
+  os << std::setw(12) << "max" << '\n';
+
+  for (std::size_t point = 0; point < NB_POINTS; point++)
+    {
+      const HistogrammeLatence histogramme = reqHistogramme(static_cast<PointMesure>(point));
+      if (histogramme.reqNbValeurs() == 0)
+        {
+          continue;
+        }
+      os << std::left << std::setw(20) << NOMS_POINTS[point] << std::right
+         << std::setw(12) << histogramme.reqNbValeurs() << std::setw(12) << histogramme.reqMin()
+         << std::setw(12) << static_cast<std::uint64_t>(histogramme.reqMoyenne());
+      for (double percentile : PERCENTILES_RAPPORT)
+        {
+          os << std::setw(12) << histogramme.reqPercentile(percentile);
+        }
+      os << std::setw(12) << histogramme.reqMax() << '\n';
+    }
+  return os.str();
+}
+
+
+/**
+ * \brief Remet à zéro les mesures de tous les fils
+ *        Une mesure enregistrée pendant la remise à zéro peut être conservée ou perdue.
+ */
+void Instrumentation::reinitialiser()
+{
+  Registre& reg = registre();
+  std::lock_guard<std::mutex> verrou(reg.m_mutex);
+  reg.m_blocTermines.vider();
+  for (BlocFil* bloc : reg.m_blocs)
+    {
+      bloc->vider();
+    }
+}
+
+
+/**
+ * \brief Retourne le nom d'un point de mesure, tel qu'il paraît dans le rapport
+ * \pre p_point < PointMesure::NB_POINTS
+ */
+const char* Instrumentation::reqNomPoint(PointMesure p_point)
+{
+  PRECONDITION (p_point < PointMesure::NB_POINTS);
+  return NOMS_POINTS[static_cast<std::size_t>(p_point)];
+}
+
+
+/**
+ * \brief Ajoute à un histogramme les mesures d'un point d'un bloc
+ */
+void Instrumentation::verser(const BlocFil& p_bloc, PointMesure p_point, HistogrammeLatence& p_histogramme)
+{
+  const std::size_t point = static_cast<std::size_t>(p_point);
+  for (unsigned i = 0; i < HistogrammeLatence::NB_CASES; i++)
+    {
+      p_histogramme.m_cases[i] += p_bloc.m_cases[point][i].load(std::memory_order_relaxed);
+    }
+  p_histogramme.m_nbValeurs += p_bloc.m_nbValeurs[point].load(std::memory_order_relaxed);
+  p_histogramme.m_somme += p_bloc.m_somme[point].load(std::memory_order_relaxed);
+  p_histogramme.m_min = std::min(p_histogramme.m_min, p_bloc.m_min[point].load(std::memory_order_relaxed));
+  p_histogramme.m_max = std::max(p_histogramme.m_max, p_bloc.m_max[point].load(std::memory_order_relaxed));
+}
+
+} // namespace util
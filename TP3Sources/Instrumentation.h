@@ -0,0 +1,167 @@
+/**
+ * \file Instrumentation.h
+ * \brief Fichier qui contient l'interface de l'instrumentation optionnelle des chemins critiques de la bibliothèque.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ *
+ * Les points de mesure sont posés avec la macro MESURER_LATENCE(point), qui mesure
+ * le temps écoulé jusqu'à la fin du bloc englobant. Ils ne sont actifs que si
+ * INSTRUMENTATION est défini à la compilation, par exemple -DINSTRUMENTATION;
+ * sinon la macro ne produit aucun code et l'instrumentation ne coûte rien.
+ * Les classes restent disponibles dans les deux cas, pour être interrogées.
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+namespace util
+{
+/**
+ * \brief Points de mesure de la bibliothèque
+ */
+enum class PointMesure : unsigned
+{
+  AJOUTER_COMPTE,
+  SUPPRIMER_COMPTE,
+  REQ_RELEVES,
+  CALCULER_INTERET,
+  VALIDATION_FICHIER,
+  CONSTRUCTION_CLIENT,
+  NB_POINTS
+};
+
+
+/**
+ * \class HistogrammeLatence
+ * \brief Histogramme de latences en nanosecondes, à cases log-linéaires comme HdrHistogram.
+ *
+ *              Les valeurs inférieures à 64 ns ont chacune leur case; au-delà, chaque
+ *              puissance de deux est divisée en 32 cases égales, ce qui borne l'erreur
+ *              relative d'un percentile à 1/32, environ 3 %, de 0 ns à plusieurs siècles.
+ *              Le minimum, le maximum et la somme sont exacts.
+ */
+class HistogrammeLatence
+{
+public:
+  static const unsigned BITS_SOUS_CASES = 5;
+  static const unsigned NB_SOUS_CASES = 1u << BITS_SOUS_CASES;
+  static const unsigned NB_CASES = (65 - BITS_SOUS_CASES) * NB_SOUS_CASES;
+
+  HistogrammeLatence();
+
+  void enregistrer(std::uint64_t p_nanosecondes);
+  void fusionner(const HistogrammeLatence& p_autre);
+  void reinitialiser();
+
+  std::uint64_t reqNbValeurs() const;
+  std::uint64_t reqMin() const;
+  std::uint64_t reqMax() const;
+  double reqMoyenne() const;
+  std::uint64_t reqPercentile(double p_percentile) const;
+  std::uint64_t reqNbValeursCase(unsigned p_case) const;
+
+  /**
+   * \brief Retourne la case d'une valeur
+   */
+  static unsigned caseDe(std::uint64_t p_valeur)
+  {
+    if (p_valeur < 2 * NB_SOUS_CASES)
+      {
+        return static_cast<unsigned>(p_valeur);
+      }
+    const unsigned exposant = 63 - static_cast<unsigned>(__builtin_clzll(p_valeur));
+    const unsigned decalage = exposant - BITS_SOUS_CASES;
+    return decalage * NB_SOUS_CASES + static_cast<unsigned>(p_valeur >> decalage);
+  }
+  static std::uint64_t borneInferieure(unsigned p_case);
+  static std::uint64_t borneSuperieure(unsigned p_case);
+
+private:
+  friend class Instrumentation;
+
+  std::array<std::uint64_t, NB_CASES> m_cases;
+  std::uint64_t m_nbValeurs;
+  std::uint64_t m_min;
+  std::uint64_t m_max;
+  std::uint64_t m_somme;
+};
+
+
+/**
+ * \class Instrumentation
+ * \brief Compteurs et histogrammes de latence par point de mesure, tenus par fil d'exécution.
+ *
+ *              Chaque fil enregistre dans son propre bloc, sans verrou ni instruction
+ *              atomique coûteuse: seul ce fil écrit dans son bloc. Les blocs sont fusionnés
+ *              à la demande par reqHistogramme() et rapport(); le bloc d'un fil terminé
+ *              est fusionné dans un bloc commun, de sorte qu'aucune mesure n'est perdue.
+ *              Une lecture concurrente à des enregistrements peut omettre les mesures
+ *              en cours, sans jamais en corrompre.
+ */
+class Instrumentation
+{
+public:
+  static void enregistrer(PointMesure p_point, std::uint64_t p_nanosecondes);
+  static HistogrammeLatence reqHistogramme(PointMesure p_point);
+  static std::uint64_t reqNbAppels(PointMesure p_point);
+  static std::string rapport();
+  static void reinitialiser();
+  static const char* reqNomPoint(PointMesure p_point);
+
+  struct BlocFil;
+
+private:
+  static void verser(const BlocFil& p_bloc, PointMesure p_point, HistogrammeLatence& p_histogramme);
+};
+
+
+/**
+ * \class MesureLatence
+ * \brief Mesure la durée de vie de l'objet et l'enregistre dans l'Instrumentation à sa destruction.
+ */
+class MesureLatence
+{
+public:
+  explicit MesureLatence(PointMesure p_point)
+    : m_point(p_point), m_debut(std::chrono::steady_clock::now()) { }
+
+  ~MesureLatence()
+  {
+    const auto duree = std::chrono::steady_clock::now() - m_debut;
+    Instrumentation::enregistrer(m_point, std::chrono::duration_cast<std::chrono::nanoseconds>(duree).count());
+  }
+
+  MesureLatence(const MesureLatence&) = delete;
+  MesureLatence& operator=(const MesureLatence&) = delete;
+
+private:
+  PointMesure m_point;
+  std::chrono::steady_clock::time_point m_debut;
+};
+
+} // namespace util
+
+
+// --- Macro des points de mesure
+
+#define INSTRUMENTATION_CONCATENER_(a, b) a##b
+#define INSTRUMENTATION_CONCATENER(a, b) INSTRUMENTATION_CONCATENER_(a, b)
+
+#if defined(INSTRUMENTATION)
+
+#define MESURER_LATENCE(point) \
+      ::util::MesureLatence INSTRUMENTATION_CONCATENER(mesureLatence, __LINE__) (::util::PointMesure::point)
+
+#else
+
+#define MESURER_LATENCE(point)
+
+#endif  // --- if defined(INSTRUMENTATION)
+
+#endif /* INSTRUMENTATION_H */
@@ -0,0 +1,227 @@
+/**
+ * \file LecteurClients.cpp
+ * \brief Implémentation de la classe LecteurClients
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "LecteurClients.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+bool estMarqueurCompte (std::string_view p_ligne)
+{
+  return p_ligne == "cheque" || p_ligne == "epargne";
+}
+}
+
+
+/**
+ * \brief Constructeur du lecteur
+ * \param[in] p_contenu le contenu multi-clients complet
+ * \post le lecteur est positionné au début du contenu, aucun rejet
+ */
+LecteurClients::LecteurClients (std::string_view p_contenu)
+  : m_lecteur(p_contenu, 0, p_contenu.size()), m_taille(p_contenu.size()), m_dansClient(false), m_nbrRejets(0)
+{
+  POSTCONDITION (reqPosition() == 0);
+}
+
+
+/**
+ * \brief Lit l'en-tête du prochain client valide
+ *        Les comptes non lus du client courant sont ignorés. Un bloc dont
+ *        l'en-tête est invalide est ignoré au complet et compté comme rejet.
+ * \return le client, sans ses comptes, ou std::nullopt à la fin du contenu
+ */
+std::optional<Client> LecteurClients::lireClient ()
+{
+  if (m_dansClient)
+    {
+      ignorerBloc();
+    }
+  while (!m_lecteur.estTermine())
+    {
+      if (m_lecteur.reqLigne().empty())
+        {
+          m_lecteur.avancer();
+          continue;
+        }
+      std::optional<Client> client = construireClient();
+      if (client)
+        {
+          m_dansClient = true;
+          return client;
+        }
+      m_nbrRejets++;
+      ignorerBloc();
+    }
+  return std::nullopt;
+}
+
+
+/**
+ * \brief Lit le prochain compte valide du client courant
+ *        Un compte invalide est compté comme rejet et la lecture reprend au
+ *        marqueur suivant, comme le fait util::validerEnregistrements.
+ * \return le compte, ou nullptr à la fin du bloc du client courant
+ */
+std::unique_ptr<Compte> LecteurClients::lireCompte ()
+{
+  while (m_dansClient && !m_lecteur.estTermine() && !m_lecteur.reqLigne().empty())
+    {
+      const bool estMarqueur = estMarqueurCompte(m_lecteur.reqLigne());
+      std::unique_ptr<Compte> compte = estMarqueur ? construireCompte() : nullptr;
+      if (compte)
+        {
+          return compte;
+        }
+      m_nbrRejets++;
+      if (!estMarqueur)
+        {
+          m_lecteur.avancer();
+        }
+      while (!m_lecteur.estTermine() && !m_lecteur.reqLigne().empty() && !estMarqueurCompte(m_lecteur.reqLigne()))
+        {
+          m_lecteur.avancer();
+        }
+    }
+  m_dansClient = false;
+  return nullptr;
+}
+
+
+/**
+ * \brief Indique si tout le contenu a été lu
+ * \return true si aucune ligne ne reste à lire
+ */
+bool LecteurClients::estTermine () const
+{
+  return m_lecteur.estTermine();
+}
+
+
+/**
+ * \brief Retourne la position de lecture, utile pour rapporter l'avancement
+ * \return le nombre d'octets déjà lus
+ */
+std::size_t LecteurClients::reqPosition () const
+{
+  return m_lecteur.reqPosition();
+}
+
+
+/**
+ * \brief Retourne la taille du contenu
+ * \return la taille du contenu en octets
+ */
+std::size_t LecteurClients::reqTaille () const
+{
+  return m_taille;
+}
+
+
+/**
+ * \brief Retourne le nombre d'en-têtes et de comptes ignorés parce qu'invalides
+ * \return le nombre de rejets
+ */
+std::uint64_t LecteurClients::reqNbrRejets () const
+{
+  return m_nbrRejets;
+}
+
+
+/**
+ * \brief Lit le champ suivant; une ligne vide termine le bloc client et n'est pas consommée
+ */
+bool LecteurClients::champSuivant (std::string_view& p_champ)
+{
+  if (m_lecteur.estTermine() || m_lecteur.reqLigne().empty())
+    {
+      return false;
+    }
+  p_champ = m_lecteur.reqLigne();
+  m_lecteur.avancer();
+  return true;
+}
+
+
+/**
+ * \brief Avance jusqu'à la ligne vide qui termine le bloc courant
+ */
+void LecteurClients::ignorerBloc ()
+{
+  while (!m_lecteur.estTermine() && !m_lecteur.reqLigne().empty())
+    {
+      m_lecteur.avancer();
+    }
+  m_dansClient = false;
+}
+
+
+/**
+ * \brief Construit un client à partir des 5 lignes d'en-tête
+ * \return le client, std::nullopt si une ligne est absente ou invalide
+ */
+std::optional<Client> LecteurClients::construireClient ()
+{
+  std::string_view nom;
+  std::string_view prenom;
+  std::string_view champ;
+  std::string_view telephone;
+  util::Date dateNaissance;
+  unsigned noFolio;
+
+  if (!champSuivant(nom) || !champSuivant(prenom)) return std::nullopt;
+  if (!champSuivant(champ) || !util::lireDate(champ, dateNaissance)) return std::nullopt;
+  if (!champSuivant(telephone)) return std::nullopt;
+  if (!champSuivant(champ) || util::lireNoFolio(champ, noFolio) != util::ErreurNombre::AUCUNE) return std::nullopt;
+
+  return Client::creer(noFolio, std::string(nom), std::string(prenom), dateNaissance, std::string(telephone));
+}
+
+
+/**
+ * \brief Construit un compte débutant par son marqueur "cheque" ou "epargne"
+ * \return le compte, nullptr si une ligne est absente ou invalide
+ */
+std::unique_ptr<Compte> LecteurClients::construireCompte ()
+{
+  const bool estCheque = m_lecteur.reqLigne() == "cheque";
+  m_lecteur.avancer();
+
+  std::string_view champ;
+  std::string_view description;
+  unsigned noCompte;
+  double taux;
+  double solde;
+
+  if (!champSuivant(champ) || util::lireNoCompte(champ, noCompte) != util::ErreurNombre::AUCUNE) return nullptr;
+  if (!champSuivant(champ) || util::lireTaux(champ, taux) != util::ErreurNombre::AUCUNE) return nullptr;
+  if (!champSuivant(champ) || util::lireSolde(champ, solde) != util::ErreurNombre::AUCUNE) return nullptr;
+  if (!champSuivant(description)) return nullptr;
+
+  if (estCheque)
+    {
+      unsigned nbrTransactions;
+      double tauxMinimum;
+      if (!champSuivant(champ) || util::lireNbrTransactions(champ, nbrTransactions) != util::ErreurNombre::AUCUNE) return nullptr;
+      if (!champSuivant(champ) || util::lireTaux(champ, tauxMinimum) != util::ErreurNombre::AUCUNE) return nullptr;
+      std::optional<Cheque> cheque = Cheque::creer(noCompte, solde, taux, nbrTransactions, tauxMinimum, std::string(description));
+      return cheque ? cheque->clone() : nullptr;
+    }
+
+  util::Date dateOuverture;
+  if (!champSuivant(champ)) return nullptr;
+  if (!champSuivant(champ) || !util::lireDate(champ, dateOuverture)) return nullptr;
+  std::optional<Epargne> epargne = Epargne::creer(noCompte, solde, taux, std::string(description), dateOuverture);
+  return epargne ? epargne->clone() : nullptr;
+}
+
+} // namespace bancaire
@@ -0,0 +1,63 @@
+/**
+ * \file LecteurClients.h
+ * \brief Fichier qui contient l'interface de la classe LecteurClients qui construit des clients à partir d'un fichier texte.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef LECTEURCLIENTS_H
+#define LECTEURCLIENTS_H
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <cstdint>
+
+#include "Client.h"
+#include "validationFichier.h"
+
+namespace bancaire
+{
+/**
+ * \class LecteurClients
+ * \brief Construit, au fil de la lecture, les clients et les comptes d'un contenu multi-clients.
+ *
+ *              Le contenu a le format accepté par util::validerEnregistrements: des blocs
+ *              clients séparés par des lignes vides, chacun formé d'un en-tête de 5 lignes
+ *              suivi de comptes débutant par "cheque" ou "epargne". La lecture se fait un
+ *              client, puis un compte à la fois, ce qui permet à l'appelant de rapporter
+ *              son avancement, de s'interrompre ou de traiter les comptes par lots.
+ *              Les objets sont construits avec les fabriques creer(): un en-tête ou un
+ *              compte invalide est ignoré et compté comme rejet, sans exception.
+ *              Le contenu doit survivre au lecteur, c'est la responsabilité de
+ *              l'utilisateur de la classe de s'en assurer.
+ */
+class LecteurClients
+{
+public:
+  explicit LecteurClients (std::string_view p_contenu);
+
+  std::optional<Client> lireClient ();
+  std::unique_ptr<Compte> lireCompte ();
+
+  bool estTermine () const;
+  std::size_t reqPosition () const;
+  std::size_t reqTaille () const;
+  std::uint64_t reqNbrRejets () const;
+
+private:
+  bool champSuivant (std::string_view& p_champ);
+  void ignorerBloc ();
+  std::optional<Client> construireClient ();
+  std::unique_ptr<Compte> construireCompte ();
+
+  util::LecteurLignes m_lecteur;
+  std::size_t m_taille;
+  bool m_dansClient;
+  std::uint64_t m_nbrRejets;
+};
+
+} // namespace bancaire
+
+#endif /* LECTEURCLIENTS_H */
@@ -0,0 +1,171 @@
+/**
+ * \file MoteurInteret.cpp
+ * \brief Implémentation de la classe MoteurInteret
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "MoteurInteret.h"
+#include "ContratException.h"
+
+using namespace std;
+namespace bancaire
+{
+/**
+ * \brief Calcule le nombre de jours entre deux dates selon une convention de décompte
+ * \param[in] p_debut la date de début de la période (exclue)
+ * \param[in] p_fin la date de fin de la période (incluse)
+ * \param[in] p_convention la convention de décompte des jours
+ * \return le nombre de jours de la période selon la convention
+ */
+int joursSelonConvention(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention)
+{
+  if (p_convention != ConventionJours::TRENTE_360)
+    {
+      return p_fin - p_debut;
+    }
+
+  int jourDebut = std::min(p_debut.reqJour(), 30);
+  int jourFin = p_fin.reqJour();
+  if (jourDebut == 30 && jourFin == 31)
+    {
+      jourFin = 30;
+    }
+  return 360 * (p_fin.reqAnnee() - p_debut.reqAnnee())
+         + 30 * (p_fin.reqMois() - p_debut.reqMois())
+         + (jourFin - jourDebut);
+}
+
+
+/**
+ * \brief Retourne le nombre de jours d'une année selon la convention de décompte
+ * \param[in] p_convention la convention de décompte des jours
+ * \return 365 pour ACT/365, 360 sinon
+ */
+int baseSelonConvention(ConventionJours p_convention)
+{
+  return p_convention == ConventionJours::ACT_365 ? 365 : 360;
+}
+
+
+/**
+ * \brief constructeur avec paramètres
+ * \param[in] p_debut la date de début de la période
+ * \param[in] p_fin la date de fin de la période
+ * \param[in] p_convention la convention de décompte des jours
+ * \pre p_debut ne doit pas être après p_fin
+ */
+MoteurInteret::MoteurInteret(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention)
+                : m_debut(p_debut), m_fin(p_fin), m_convention(p_convention)
+{
+  PRECONDITION (!(p_fin < p_debut));
+
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Ajoute un compte epargne au lot à calculer
+ *        Le compte court à partir de sa date d'ouverture si elle tombe dans la période.
+ * \param[in] p_compte le compte epargne à ajouter
+ * \post le nombre de comptes du moteur est augmenté de 1
+ */
+void MoteurInteret::ajouterCompte(const Epargne& p_compte)
+{
+  const util::Date& ouverture = p_compte.reqDateOuvertureRef();
+  const util::Date& debut = m_debut < ouverture ? ouverture : m_debut;
+
+  int jours = 0;
+  if (!(m_fin < debut))
+    {
+      jours = joursSelonConvention(debut, m_fin, m_convention);
+    }
+
+  m_soldes.push_back(p_compte.reqSolde());
+  m_taux.push_back(p_compte.reqTauxInteret());
+  m_jours.push_back(jours);
+  m_interets.push_back(0.0);
+
+  INVARIANTS();
+}
+
+
+/**
+ * \brief Calcule les intérêts courus de tous les comptes ajoutés
+ *        Le taux est un pourcentage annuel, d'où la division par 100 et par la base.
+ */
+void MoteurInteret::calculer()
+{
+  const double facteur = 1.0 / (100.0 * baseSelonConvention(m_convention));
+  const size_t n = m_soldes.size();
+  const double* soldes = m_soldes.data();
+  const double* taux = m_taux.data();
+  const double* jours = m_jours.data();
+  double* interets = m_interets.data();
+
+  for (size_t i = 0; i < n; i++)
+    {
+      interets[i] = soldes[i] * taux[i] * jours[i] * facteur;
+    }
+}
+
+
+/**
+ * \brief méthode accesseur retournant le nombre de comptes du lot
+ * \return le nombre de comptes ajoutés au moteur
+ */
+size_t MoteurInteret::reqNbrComptes() const
+{
+  return m_soldes.size();
+}
+
+
+/**
+ * \brief méthode accesseur retournant l'intérêt couru d'un compte
+ * \param[in] p_rang le rang d'ajout du compte
+ * \return l'intérêt couru calculé par le dernier appel à calculer()
+ * \pre p_rang doit être plus petit que le nombre de comptes
+ */
+double MoteurInteret::reqInteret(size_t p_rang) const
+{
+  PRECONDITION (p_rang < m_interets.size());
+
+  return m_interets[p_rang];
+}
+
+
+/**
+ * \brief méthode accesseur retournant les intérêts courus de tous les comptes
+ * \return les intérêts dans l'ordre d'ajout des comptes
+ */
+const std::vector<double>& MoteurInteret::reqInterets() const
+{
+  return m_interets;
+}
+
+
+/**
+ * \brief Retourne la somme des intérêts courus du lot
+ * \return le total des intérêts calculés par le dernier appel à calculer()
+ */
+double MoteurInteret::reqTotal() const
+{
+  return std::accumulate(m_interets.begin(), m_interets.end(), 0.0);
+}
+
+
+/**
+ * \brief Teste l'invariant de la classe MoteurInteret
+ */
+void MoteurInteret::verifieInvariant() const
+{
+  INVARIANT (m_taux.size() == m_soldes.size());
+  INVARIANT (m_jours.size() == m_soldes.size());
+  INVARIANT (m_interets.size() == m_soldes.size());
+}
+
+} // namespace bancaire
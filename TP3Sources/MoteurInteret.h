@@ -0,0 +1,70 @@
+/**
+ * \file MoteurInteret.h
+ * \brief Fichier qui contient l'interface de la classe MoteurInteret qui sert au calcul des intérêts courus sur une période.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef MOTEURINTERET_H
+#define MOTEURINTERET_H
+
+#include <vector>
+
+#include "Date.h"
+#include "Epargne.h"
+
+namespace bancaire
+{
+/**
+ * \enum ConventionJours
+ * \brief Convention de décompte des jours utilisée pour la fraction d'année.
+ *
+ *              ACT_365 et ACT_360 comptent les jours réels entre deux dates,
+ *              TRENTE_360 considère des mois de 30 jours (base obligataire).
+ */
+enum class ConventionJours { ACT_365, ACT_360, TRENTE_360 };
+
+int joursSelonConvention(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention);
+int baseSelonConvention(ConventionJours p_convention);
+
+/**
+ * \class MoteurInteret
+ * \brief Classe servant au calcul des intérêts courus d'un lot de comptes epargne sur une période.
+ *
+ *              Les comptes sont d'abord ajoutés au moteur, qui conserve leur solde,
+ *              leur taux annuel et leur nombre de jours courus dans des tableaux contigus.
+ *              Le calcul lui-même est une boucle sans branchement sur ces tableaux,
+ *              que le compilateur peut vectoriser.
+ *              Un compte ouvert pendant la période ne court qu'à partir de sa
+ *              date d'ouverture, un compte ouvert après la fin ne court pas.
+ * \invariant Les tableaux de soldes, taux, jours et intérêts ont la même taille
+ */
+class MoteurInteret
+{
+public:
+  MoteurInteret(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention);
+
+  void ajouterCompte(const Epargne& p_compte);
+  void calculer();
+
+  size_t reqNbrComptes() const;
+  double reqInteret(size_t p_rang) const;
+  const std::vector<double>& reqInterets() const;
+  double reqTotal() const;
+
+private:
+  util::Date m_debut;
+  util::Date m_fin;
+  ConventionJours m_convention;
+  std::vector<double> m_soldes;
+  std::vector<double> m_taux;
+  std::vector<double> m_jours;
+  std::vector<double> m_interets;
+
+  void verifieInvariant() const;
+};
+
+} // namespace bancaire
+
+#endif /* MOTEURINTERET_H */
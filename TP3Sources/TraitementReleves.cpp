@@ -0,0 +1,305 @@
+/**
+ * \file TraitementReleves.cpp
+ * \brief Implémentation de la classe TraitementReleves
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "TraitementReleves.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "FormateurReleve.h"
+#include "GroupeFils.h"
+
+using namespace std;
+namespace bancaire
+{
+namespace
+{
+using Horloge = std::chrono::steady_clock;
+
+const unsigned NB_LOTS = (Banque::FOLIO_MAX - Banque::FOLIO_MIN + TraitementReleves::TAILLE_LOT - 1) / TraitementReleves::TAILLE_LOT;
+
+/**
+ * \brief Écrit tout le texte dans un descripteur
+ * \exception std::runtime_error si l'écriture échoue
+ */
+void ecrireTout(int p_descripteur, std::string_view p_texte)
+{
+  while (!p_texte.empty())
+    {
+      ssize_t ecrits = ::write(p_descripteur, p_texte.data(), p_texte.size());
+      if (ecrits < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+          throw std::runtime_error("Erreur d'écriture d'un relevé");
+        }
+      p_texte.remove_prefix(static_cast<std::size_t>(ecrits));
+    }
+}
+
+
+double microsecondesDepuis(Horloge::time_point p_debut)
+{
+  return std::chrono::duration<double, std::micro>(Horloge::now() - p_debut).count();
+}
+
+
+/**
+ * \class Sequenceur
+ * \brief Fait écrire les lots dans l'ordre de leur numéro, quel que soit le fil qui les a rendus
+ */
+class Sequenceur
+{
+public:
+  Sequenceur () : m_prochainLot(0), m_abandon(false) { }
+
+  /**
+   * \return faux si le traitement a été abandonné
+   */
+  bool attendreTour (unsigned p_lot, std::unique_lock<std::mutex>& p_verrou)
+  {
+    p_verrou = std::unique_lock<std::mutex>(m_mutex);
+    m_condition.wait(p_verrou, [&] { return m_prochainLot == p_lot || m_abandon; });
+    return !m_abandon;
+  }
+
+  void terminerTour (std::unique_lock<std::mutex>& p_verrou)
+  {
+    m_prochainLot++;
+    p_verrou.unlock();
+    m_condition.notify_all();
+  }
+
+  void abandonner ()
+  {
+    {
+      std::lock_guard<std::mutex> verrou(m_mutex);
+      m_abandon = true;
+    }
+    m_condition.notify_all();
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  unsigned m_prochainLot;
+  bool m_abandon;
+};
+
+
+/**
+ * \brief Répartit les lots de folios entre p_nbFils fils et mesure le traitement
+ * \param[in] p_traiterLot appelé avec (lot, formateur, latences, octets) pour chaque lot
+ * \param[in] p_sequenceur abandonné si un fil échoue, nullptr s'il n'y en a pas
+ * \exception la première exception lancée par un fil, une fois tous les fils terminés
+ */
+template <typename TraiterLot>
+StatistiquesReleves executer(unsigned p_nbFils, TraiterLot p_traiterLot, Sequenceur* p_sequenceur)
+{
+  std::atomic<unsigned> prochainLot(0);
+  std::atomic<bool> echec(false);
+  std::vector<std::exception_ptr> erreurs(p_nbFils);
+  std::vector<std::vector<double>> latences(p_nbFils);
+  std::vector<std::uint64_t> octets(p_nbFils, 0);
+
+  auto travailleur = [&] (unsigned p_fil)
+    {
+      FormateurReleve formateur;
+      try
+        {
+          for (unsigned lot = prochainLot++; lot < NB_LOTS && !echec; lot = prochainLot++)
+            {
+              p_traiterLot(lot, formateur, latences[p_fil], octets[p_fil]);
+            }
+        }
+      catch (...)
+        {
+          erreurs[p_fil] = std::current_exception();
+          echec = true;
+          if (p_sequenceur != nullptr)
+            {
+              p_sequenceur->abandonner();
+            }
+        }
+    };
+
+  Horloge::time_point debut = Horloge::now();
+  util::GroupeFils fils;
+  try
+    {
+      for (unsigned i = 1; i < p_nbFils; i++)
+        {
+          fils.lancer([&travailleur, i] { travailleur(i); });
+        }
+    }
+  catch (...)
+    {
+      // les fils déjà lancés s'arrêtent au lot suivant et sont joints par le groupe
+      echec = true;
+      if (p_sequenceur != nullptr)
+        {
+          p_sequenceur->abandonner();
+        }
+      throw;
+    }
+  travailleur(0);
+  fils.joindre();
+  double duree = std::chrono::duration<double>(Horloge::now() - debut).count();
+
+  for (const auto& erreur : erreurs)
+    {
+      if (erreur)
+        {
+          std::rethrow_exception(erreur);
+        }
+    }
+
+  std::vector<double> toutes;
+  StatistiquesReleves statistiques = {0, 0, duree, 0.0, 0.0, 0.0, 0.0, 0.0};
+  for (unsigned i = 0; i < p_nbFils; i++)
+    {
+      toutes.insert(toutes.end(), latences[i].begin(), latences[i].end());
+      statistiques.m_nbrOctets += octets[i];
+    }
+  statistiques.m_nbrClients = toutes.size();
+  if (!toutes.empty())
+    {
+      std::sort(toutes.begin(), toutes.end());
+      auto centile = [&] (double p_fraction)
+        {
+          std::size_t rang = static_cast<std::size_t>(p_fraction * toutes.size());
+          return toutes[std::min(rang, toutes.size() - 1)];
+        };
+      statistiques.m_clientsParSeconde = duree > 0.0 ? toutes.size() / duree : 0.0;
+      statistiques.m_latenceP50Microsecondes = centile(0.50);
+      statistiques.m_latenceP99Microsecondes = centile(0.99);
+      statistiques.m_latenceP999Microsecondes = centile(0.999);
+      statistiques.m_latenceMaxMicrosecondes = toutes.back();
+    }
+  return statistiques;
+}
+} // namespace
+
+
+/**
+ * \brief constructeur avec paramètres
+ * \param[in] p_banque la banque dont les relevés seront produits
+ * \param[in] p_nbFils le nombre de fils d'exécution, 0 pour un fil par coeur
+ */
+TraitementReleves::TraitementReleves(const Banque& p_banque, unsigned p_nbFils)
+  : m_banque(p_banque), m_nbFils(p_nbFils != 0 ? p_nbFils : std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+
+/**
+ * \brief Produit un fichier de relevé par client, nommé releve_<folio>.txt
+ * \param[in] p_repertoire le répertoire, existant, où écrire les fichiers
+ * \return le débit et les latences du traitement
+ * \exception std::runtime_error si un fichier ne peut pas être créé ou écrit
+ */
+StatistiquesReleves TraitementReleves::genererFichiers(const std::string& p_repertoire) const
+{
+  auto traiterLot = [&] (unsigned p_lot, FormateurReleve& p_formateur, std::vector<double>& p_latences, std::uint64_t& p_octets)
+    {
+      std::string chemin;
+      unsigned fin = std::min(Banque::FOLIO_MIN + (p_lot + 1) * TAILLE_LOT, Banque::FOLIO_MAX);
+      for (unsigned noFolio = Banque::FOLIO_MIN + p_lot * TAILLE_LOT; noFolio < fin; noFolio++)
+        {
+          if (!m_banque.estClientPresent(noFolio))
+            {
+              continue;
+            }
+          Horloge::time_point debut = Horloge::now();
+          std::string_view releve = p_formateur.formaterReleves(m_banque.reqClient(noFolio));
+
+          chemin = p_repertoire + "/releve_" + std::to_string(noFolio) + ".txt";
+          int descripteur = ::open(chemin.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+          if (descripteur < 0)
+            {
+              throw std::runtime_error("Impossible de créer le fichier " + chemin);
+            }
+          try
+            {
+              ecrireTout(descripteur, releve);
+            }
+          catch (...)
+            {
+              ::close(descripteur);
+              throw;
+            }
+          ::close(descripteur);
+
+          p_latences.push_back(microsecondesDepuis(debut));
+          p_octets += releve.size();
+        }
+    };
+  return executer(m_nbFils, traiterLot, nullptr);
+}
+
+
+/**
+ * \brief Produit les relevés de tous les clients, en ordre de folio, dans un seul fichier
+ *        Chaque fil rend un lot complet dans son tampon, puis l'écrit à son tour.
+ * \param[in] p_descripteur le descripteur du fichier, ouvert en écriture; il n'est pas fermé
+ * \return le débit et les latences de rendu du traitement
+ * \exception std::runtime_error si l'écriture échoue
+ */
+StatistiquesReleves TraitementReleves::genererFichierUnique(int p_descripteur) const
+{
+  Sequenceur sequenceur;
+  auto traiterLot = [&] (unsigned p_lot, FormateurReleve& p_formateur, std::vector<double>& p_latences, std::uint64_t& p_octets)
+    {
+      thread_local std::string tamponLot;
+      tamponLot.clear();
+      unsigned fin = std::min(Banque::FOLIO_MIN + (p_lot + 1) * TAILLE_LOT, Banque::FOLIO_MAX);
+      for (unsigned noFolio = Banque::FOLIO_MIN + p_lot * TAILLE_LOT; noFolio < fin; noFolio++)
+        {
+          if (m_banque.estClientPresent(noFolio))
+            {
+              Horloge::time_point debut = Horloge::now();
+              tamponLot += p_formateur.formaterReleves(m_banque.reqClient(noFolio));
+              p_latences.push_back(microsecondesDepuis(debut));
+            }
+        }
+
+      std::unique_lock<std::mutex> verrou;
+      if (sequenceur.attendreTour(p_lot, verrou))
+        {
+          ecrireTout(p_descripteur, tamponLot);
+          p_octets += tamponLot.size();
+          sequenceur.terminerTour(verrou);
+        }
+    };
+  return executer(m_nbFils, traiterLot, &sequenceur);
+}
+
+
+/**
+ * \brief méthode accesseur retournant le nombre de fils d'exécution
+ * \return le nombre de fils utilisés par un traitement
+ */
+unsigned TraitementReleves::reqNbFils() const
+{
+  return m_nbFils;
+}
+
+} // namespace bancaire
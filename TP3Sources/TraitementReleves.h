@@ -0,0 +1,68 @@
+/**
+ * \file TraitementReleves.h
+ * \brief Fichier qui contient l'interface de la classe TraitementReleves qui sert à la production parallèle des relevés de fin de mois.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef TRAITEMENTRELEVES_H
+#define TRAITEMENTRELEVES_H
+
+#include <string>
+#include <cstdint>
+
+#include "Banque.h"
+
+namespace bancaire
+{
+/**
+ * \struct StatistiquesReleves
+ * \brief Débit et latences d'un traitement de relevés.
+ *
+ *              Les latences mesurent, pour chaque client, le rendu de son relevé
+ *              et son écriture lorsqu'elle lui est propre (un fichier par client).
+ */
+struct StatistiquesReleves
+{
+  std::size_t m_nbrClients;
+  std::uint64_t m_nbrOctets;
+  double m_dureeSecondes;
+  double m_clientsParSeconde;
+  double m_latenceP50Microsecondes;
+  double m_latenceP99Microsecondes;
+  double m_latenceP999Microsecondes;
+  double m_latenceMaxMicrosecondes;
+};
+
+
+/**
+ * \class TraitementReleves
+ * \brief Classe servant à produire en parallèle les relevés de tous les clients d'une banque.
+ *
+ *              Les folios sont répartis par petits lots entre les fils d'exécution, qui
+ *              prennent le lot suivant dès qu'ils ont terminé le leur. Chaque fil rend
+ *              ses relevés avec son propre FormateurReleve, dont le tampon est réutilisé.
+ *              Le texte de chaque relevé est celui de Client::reqReleves.
+ *              La banque ne doit pas être modifiée pendant un traitement.
+ */
+class TraitementReleves
+{
+public:
+  explicit TraitementReleves(const Banque& p_banque, unsigned p_nbFils = 0);
+
+  StatistiquesReleves genererFichiers(const std::string& p_repertoire) const;
+  StatistiquesReleves genererFichierUnique(int p_descripteur) const;
+
+  unsigned reqNbFils() const;
+
+  static const unsigned TAILLE_LOT = 16;
+
+private:
+  const Banque& m_banque;
+  unsigned m_nbFils;
+};
+
+} // namespace bancaire
+
+#endif /* TRAITEMENTRELEVES_H */
@@ -0,0 +1,250 @@
+/**
+ * \file AllocationsTesteur.cpp
+ * \brief Budgets d'allocations sur le monceau des opérations courantes de la bibliothèque
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          Client: reqNoFolio, reqCompte, reqNom, reqPrenom, reqDateNaissance, reqNomVue, reqPrenomVue,
+ *                  reqTelephoneVue, reqDateNaissanceRef, essayerAjouterCompte,
+ *                  essayerSupprimerCompte, reqClientFormate, reqReleves, Client(const Client&)
+ *          Compte: reqSolde, calculerInteret, reqDescription, reqDescriptionVue, reqCompteFormate
+ *          IndexComptes::chercherNumero, FormateurReleve::formaterReleves
+ *          util::validerFormatNom, util::validerFormatDate
+ *          std::pmr::new_delete_resource, opérateur new aligné
+ *
+ * Chaque test échoue si une opération dépasse son budget d'allocations. Un budget
+ * ne se relève que par une décision explicite; l'abaisser après une optimisation
+ * est bienvenu. Les budgets sont ceux du niveau CONTRAT_NIVEAU_DEFAUT ou inférieur:
+ * ce fichier et la bibliothèque qu'il lie se compilent dans la configuration Defaut.
+ * Au niveau AUDIT, les vérifications formatent et copient, et donc allouent.
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "CompteurAllocations.h"
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "FormateurReleve.h"
+#include "IndexComptes.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+#if CONTRAT_NIVEAU >= CONTRAT_NIVEAU_AUDIT
+#error "AllocationsTesteur se compile au niveau CONTRAT_NIVEAU_DEFAUT, voir la configuration Defaut"
+#endif
+
+using namespace std;
+using namespace bancaire;
+using essai::Allocations;
+using essai::compterAllocations;
+
+namespace
+{
+const size_t NB_COMPTES = 40;
+}
+
+
+/**
+ * \class UnClientVolumineux
+ * \brief création d'une fixture: un client aux noms trop longs pour l'optimisation des
+ *        petites chaînes, avec des comptes chèque et épargne en alternance
+ */
+class UnClientVolumineux: public::testing::Test
+{
+public:
+  UnClientVolumineux ()
+    : t_client(3333, "Dortelus-Fitzgerald", "Marie-Josephine-Aisha", util::Date(7, 9, 1988), "418 656-2131")
+  {
+    for (unsigned i = 0; i < NB_COMPTES; i++)
+      {
+        if (i % 2 == 0)
+          {
+            t_client.ajouterCompte(Cheque(100 + i, -12.5 * i, 2.345, 5, 0.125, "Compte courant du ménage"));
+          }
+        else
+          {
+            t_client.ajouterCompte(Epargne(100 + i, 10.0 * i, 1.5, "Reer", util::Date(1, 1, 2020)));
+          }
+      }
+  }
+  Client t_client;
+};
+
+
+/**
+ * \brief Test des recherches et lectures de solde
+ *        cas valides:
+ *          lectures: numéro de folio, compte par rang, solde, intérêts et téléphone sans allocation
+ *          recherches: recherche par numéro dans l'index et compte absent sans allocation
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClientVolumineux, lectures)
+{
+  volatile double total = 0.0;
+  Allocations allocations = compterAllocations([&]
+    {
+      total = total + t_client.reqNoFolio() + t_client.reqNoTelephone();
+      for (size_t i = 0; i < t_client.reqNbrComptes(); i++)
+        {
+          total = total + t_client.reqCompte(i).reqSolde() + t_client.reqCompte(i).calculerInteret();
+        }
+    });
+  ASSERT_EQ(allocations.m_nbAllocations, 0);
+  allocations = compterAllocations([&] { t_client.reqTelephoneFormate(); });
+  ASSERT_EQ(allocations.m_nbAllocations, 0);
+}
+TEST_F(UnClientVolumineux, recherches)
+{
+  IndexComptes index(t_client);
+  volatile uint32_t rang = 0;
+  Allocations allocations = compterAllocations([&]
+    {
+      for (unsigned noCompte = 100; noCompte < 100 + NB_COMPTES; noCompte++)
+        {
+          rang = *index.chercherNumero(noCompte);
+        }
+    });
+  ASSERT_EQ(allocations.m_nbAllocations, 0);
+  allocations = compterAllocations([&] { t_client.essayerSupprimerCompte(99); });
+  ASSERT_EQ(allocations.m_nbAllocations, 0);
+}
+
+
+/**
+ * \brief Test des accesseurs de chaînes et de dates
+ *        cas valides:
+ *          accesseurs: au plus une copie de chaîne par appel
+ *          accesseursVue: vues et références sans allocation, y compris pour trier par nom
+ *          validations: validerFormatNom et validerFormatDate sans allocation
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClientVolumineux, accesseurs)
+{
+  ASSERT_LE(compterAllocations([&] { t_client.reqNom(); }).m_nbAllocations, 1);
+  ASSERT_LE(compterAllocations([&] { t_client.reqPrenom(); }).m_nbAllocations, 1);
+  ASSERT_LE(compterAllocations([&] { t_client.reqDateNaissance(); }).m_nbAllocations, 1);
+  ASSERT_LE(compterAllocations([&] { t_client.reqCompte(0).reqDescription(); }).m_nbAllocations, 1);
+  ASSERT_LE(compterAllocations([&] { t_client.reqCompte(0).reqDateOuverture(); }).m_nbAllocations, 1);
+}
+TEST_F(UnClientVolumineux, accesseursVue)
+{
+  vector<Client> clients;
+  for (const char* nom : {"Tremblay-Gagnon", "Bouchard-Lavoie", "Cote-Pelletier-Roy"})
+    {
+      clients.emplace_back(1000 + clients.size(), nom, "Marie-Josephine", util::Date(1, 1, 1990), "418 656-2131");
+    }
+  volatile size_t total = 0;
+  Allocations allocations = compterAllocations([&]
+    {
+      total = total + t_client.reqNomVue().size() + t_client.reqPrenomVue().size()
+        + t_client.reqTelephoneVue().size() + t_client.reqDateNaissanceRef().reqAnnee()
+        + t_client.reqCompte(0).reqDescriptionVue().size() + t_client.reqCompte(0).reqDateOuvertureRef().reqJour();
+      vector<const Client*> parNom = {&clients[0], &clients[1], &clients[2]};
+      sort(parNom.begin(), parNom.end(), [](const Client* p_a, const Client* p_b)
+        {
+          return p_a->reqNomVue() < p_b->reqNomVue();
+        });
+      total = total + parNom[0]->reqNoFolio();
+    });
+  ASSERT_EQ(allocations.m_nbAllocations, 1) << "seul le vecteur de pointeurs alloue";
+}
+TEST(Allocations, validations)
+{
+  int jour;
+  int mois;
+  int annee;
+  Allocations allocations = compterAllocations([&]
+    {
+      util::validerFormatNom("Marie-Joséphine");
+      util::validerFormatDate("07 09 1988", jour, mois, annee);
+    });
+  ASSERT_EQ(allocations.m_nbAllocations, 0);
+}
+
+
+/**
+ * \brief Test du rendu des relevés
+ *        cas valides:
+ *          formateurReleve: aucune allocation une fois le tampon du fil agrandi
+ *          reqReleves: au plus 6 allocations par compte et 6 pour le client
+ *          formatage: reqCompteFormate et reqClientFormate dans leur budget
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClientVolumineux, formateurReleve)
+{
+  FormateurReleve& formateur = FormateurReleve::duFil();
+  formateur.formaterReleves(t_client);
+  ASSERT_EQ(compterAllocations([&] { formateur.formaterReleves(t_client); }).m_nbAllocations, 0);
+}
+TEST_F(UnClientVolumineux, reqReleves)
+{
+  Allocations allocations = compterAllocations([&] { t_client.reqReleves(); });
+  ASSERT_LE(allocations.m_nbAllocations, 6 + 6 * NB_COMPTES) << allocations.m_nbOctets << " octets";
+}
+TEST_F(UnClientVolumineux, formatage)
+{
+  ASSERT_LE(compterAllocations([&] { t_client.reqCompte(0).reqCompteFormate(); }).m_nbAllocations, 6);
+  ASSERT_LE(compterAllocations([&] { t_client.reqCompte(1).reqCompteFormate(); }).m_nbAllocations, 6);
+  ASSERT_LE(compterAllocations([&] { t_client.reqClientFormate(); }).m_nbAllocations, 5);
+}
+
+
+/**
+ * \brief Test de l'ajout de comptes et de la copie d'un client
+ *        cas valides:
+ *          ajout: une allocation par compte ajouté, hors croissance du vecteur
+ *          copie: au plus deux allocations par compte, une par chaîne du client
+ *                 et les agrandissements successifs du vecteur de comptes
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClientVolumineux, ajout)
+{
+  Epargne epargne(999, 1.0, 1.0, "Reer");
+  t_client.essayerAjouterCompte(epargne);
+  t_client.essayerSupprimerCompte(999);
+  Allocations allocations = compterAllocations([&] { t_client.essayerAjouterCompte(epargne); });
+  ASSERT_LE(allocations.m_nbAllocations, 1);
+}
+TEST_F(UnClientVolumineux, copie)
+{
+  Allocations allocations = compterAllocations([&] { Client copie(t_client); });
+  ASSERT_LE(allocations.m_nbAllocations, 3 + 2 * NB_COMPTES + 8) << allocations.m_nbOctets << " octets";
+}
+
+
+/**
+ * \brief Test du comptage des allocations alignées
+ *        cas valides:
+ *          alignees: vecteur d'un type sur-aligné et new_delete_resource avec un grand alignement
+ *                    sont comptés, octets compris
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST(Allocations, alignees)
+{
+  struct alignas(64) Bloc
+  {
+    char m_octets[64];
+  };
+  Allocations allocations = compterAllocations([]
+    {
+      vector<Bloc> blocs(1);
+      std::pmr::memory_resource* ressource = std::pmr::new_delete_resource();
+      void* bloc = ressource->allocate(256, 128);
+      ressource->deallocate(bloc, 256, 128);
+    });
+  ASSERT_EQ(allocations.m_nbAllocations, 2);
+  ASSERT_EQ(allocations.m_nbOctets, 64 + 256);
+}
@@ -0,0 +1,508 @@
+/**
+ * \file BancEssaiPerformance.cpp
+ * \brief Bancs d'essai de performance (Google Benchmark) de la bibliothèque TP3Sources
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A mesurer:
+ *          void Client::ajouterCompte (const Compte& p_nouveauCompte);
+ *          void Client::supprimerCompte (int p_noCompte);
+ *          Client(const Client& p_client);
+ *          Client(const Client& p_client, std::pmr::memory_resource* p_ressource);
+ *          Client::~Client(), sur le monceau et dans une arène
+ *          std::string Client::reqReleves() const;
+ *          double Cheque::calculerInteret() const;
+ *          double Epargne::calculerInteret() const;
+ *          void Date::ajouteNbJour(int p_nbjour);
+ *          int Date::operator-(const Date& p_date) const;
+ *          std::string Date::reqDateFormatee() const;
+ *          char* Date::ecrireDateFormatee(char* p_tampon) const;
+ *          bool validerFormatNom(std::string_view p_nom);
+ *          std::vector<std::uint64_t> validerColonneNoms(const std::vector<std::string_view>& p_noms);
+ *          bool validerFormatDate (std::string_view p_ligne, int& p_jour, int& p_mois, int& p_annee);
+ *          ErreurNombre lireSolde(std::string_view p_champ, double& p_solde);
+ *          ErreurNombre lireTelephone(std::string_view p_champ, std::uint64_t& p_noTelephone);
+ *          bool validerFormatFichier(std::istream& p_is);
+ *          StatistiquesReleves TraitementReleves::genererFichierUnique(int p_descripteur) const;
+ *
+ * Les mesures qui dépendent du volume sont paramétrées par le nombre de comptes du
+ * client. Sans option --benchmark_out, les résultats sont aussi écrits en JSON dans
+ * BancEssaiPerformance.json, afin d'être comparés d'une version à l'autre, par exemple
+ * avec l'outil compare.py de Google Benchmark. Les mesures n'ont de sens qu'avec la
+ * configuration Release, compilée avec optimisations.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "validationFormat.h"
+#include "Banque.h"
+#include "GenerateurClients.h"
+#include "TraitementReleves.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace std;
+using namespace bancaire;
+
+namespace
+{
+const unsigned PREMIER_NO_COMPTE = 10;
+
+/**
+ * \brief Construit un client de p_nbrComptes comptes, en alternant chèque et épargne
+ */
+Client creerClient (std::size_t p_nbrComptes)
+{
+  Client client(3333, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131");
+  vector<unique_ptr<Compte>> comptes;
+  comptes.reserve(p_nbrComptes);
+  for (std::size_t i = 0; i < p_nbrComptes; i++)
+    {
+      const unsigned noCompte = PREMIER_NO_COMPTE + static_cast<unsigned>(i);
+      if (i % 2 == 0)
+        {
+          comptes.push_back(make_unique<Cheque>(noCompte, -100.0 - static_cast<double>(i % 1000), 0.5,
+                                                static_cast<unsigned>(i % 41), 0.1, "Compte courant"));
+        }
+      else
+        {
+          comptes.push_back(make_unique<Epargne>(noCompte, 1000.0 + static_cast<double>(i % 1000), 1.5, "Reer"));
+        }
+    }
+  client.essayerAjouterComptes(std::move(comptes));
+  return client;
+}
+
+void tailleClients (benchmark::internal::Benchmark* p_banc)
+{
+  p_banc->RangeMultiplier(4)->Range(16, 16 << 10);
+}
+
+/**
+ * \brief Tailles de client, chacune sur le monceau (0) et dans une arène (1)
+ */
+void tailleClientsEtRessource (benchmark::internal::Benchmark* p_banc)
+{
+  for (long nbrComptes = 16; nbrComptes <= (16 << 10); nbrComptes *= 4)
+    {
+      p_banc->Args({nbrComptes, 0})->Args({nbrComptes, 1});
+    }
+}
+
+/**
+ * \brief Octets en usage dans le monceau de la glibc, en-têtes compris; 0 ailleurs
+ */
+std::size_t octetsMonceau ()
+{
+#if defined(__GLIBC__)
+  return mallinfo2().uordblks + mallinfo2().hblkhd;
+#else
+  return 0;
+#endif
+}
+
+const char* const CLIENT_VALIDE =
+  "Dortelus\nJudith\n07 09 1988\n418 656-2131\n3333\n";
+}
+
+
+/**
+ * \brief Ajout de N comptes, un à un, à un client vide
+ */
+static void BM_ClientAjouterCompte (benchmark::State& p_etat)
+{
+  const std::size_t nbrComptes = p_etat.range(0);
+  Cheque modele(PREMIER_NO_COMPTE, 100.0, 0.5, 3, 0.1, "Compte courant");
+  for (auto _ : p_etat)
+    {
+      Client client(3333, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131");
+      for (std::size_t i = 0; i < nbrComptes; i++)
+        {
+          modele = Cheque(PREMIER_NO_COMPTE + static_cast<unsigned>(i), 100.0, 0.5, 3, 0.1, "Compte courant");
+          client.ajouterCompte(modele);
+        }
+      benchmark::DoNotOptimize(client.reqNbrComptes());
+    }
+  p_etat.SetItemsProcessed(p_etat.iterations() * nbrComptes);
+  p_etat.SetComplexityN(nbrComptes);
+}
+BENCHMARK(BM_ClientAjouterCompte)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Suppression de tous les comptes d'un client de N comptes, du dernier au premier
+ */
+static void BM_ClientSupprimerCompte (benchmark::State& p_etat)
+{
+  const std::size_t nbrComptes = p_etat.range(0);
+  const Client reference = creerClient(nbrComptes);
+  for (auto _ : p_etat)
+    {
+      p_etat.PauseTiming();
+      Client client(reference);
+      p_etat.ResumeTiming();
+      for (std::size_t i = nbrComptes; i > 0; i--)
+        {
+          client.supprimerCompte(PREMIER_NO_COMPTE + static_cast<int>(i) - 1);
+        }
+      benchmark::DoNotOptimize(client.reqNbrComptes());
+    }
+  p_etat.SetItemsProcessed(p_etat.iterations() * nbrComptes);
+  p_etat.SetComplexityN(nbrComptes);
+}
+BENCHMARK(BM_ClientSupprimerCompte)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Copie profonde d'un client de N comptes
+ */
+static void BM_ClientCopie (benchmark::State& p_etat)
+{
+  const Client reference = creerClient(p_etat.range(0));
+  for (auto _ : p_etat)
+    {
+      Client copie(reference);
+      benchmark::DoNotOptimize(copie.reqNbrComptes());
+    }
+  p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+  p_etat.SetComplexityN(p_etat.range(0));
+}
+BENCHMARK(BM_ClientCopie)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Copie d'un client de N comptes dans une arène, puis libération de l'arène;
+ *        à comparer à BM_ClientCopie, qui comprend aussi la destruction
+ */
+static void BM_ClientCopieArene (benchmark::State& p_etat)
+{
+  const Client reference = creerClient(p_etat.range(0));
+  pmr::monotonic_buffer_resource arene;
+  for (auto _ : p_etat)
+    {
+      {
+        Client copie(reference, &arene);
+        benchmark::DoNotOptimize(copie.reqNbrComptes());
+      }
+      arene.release();
+    }
+  p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+  p_etat.SetComplexityN(p_etat.range(0));
+}
+BENCHMARK(BM_ClientCopieArene)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Destruction d'un client de N comptes, sur le monceau ou dans une arène rendue
+ *        d'un coup; le compteur octets_monceau donne l'empreinte du client dans le
+ *        monceau de la glibc, en-têtes et chutes compris
+ */
+static void BM_ClientDestruction (benchmark::State& p_etat)
+{
+  const bool dansArene = p_etat.range(1) == 1;
+  const Client reference = creerClient(p_etat.range(0));
+  pmr::monotonic_buffer_resource arene;
+  pmr::memory_resource* ressource = dansArene ? static_cast<pmr::memory_resource*>(&arene)
+                                              : pmr::new_delete_resource();
+  double empreinte = 0.0;
+  for (auto _ : p_etat)
+    {
+      p_etat.PauseTiming();
+      const std::size_t avant = octetsMonceau();
+      auto copie = make_unique<Client>(reference, ressource);
+      empreinte = static_cast<double>(octetsMonceau() - avant);
+      p_etat.ResumeTiming();
+      copie.reset();
+      arene.release();
+    }
+  p_etat.counters["octets_monceau"] = empreinte;
+  p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+  p_etat.SetLabel(dansArene ? "arene" : "monceau");
+}
+BENCHMARK(BM_ClientDestruction)->Apply(tailleClientsEtRessource);
+
+
+/**
+ * \brief Relevé complet d'un client de N comptes
+ */
+static void BM_ClientReqReleves (benchmark::State& p_etat)
+{
+  const Client client = creerClient(p_etat.range(0));
+  std::size_t octets = 0;
+  for (auto _ : p_etat)
+    {
+      string releves = client.reqReleves();
+      octets += releves.size();
+      benchmark::DoNotOptimize(releves.data());
+    }
+  p_etat.SetBytesProcessed(octets);
+  p_etat.SetComplexityN(p_etat.range(0));
+}
+BENCHMARK(BM_ClientReqReleves)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Intérêt d'un compte chèque à solde négatif, pour chaque palier de transactions
+ */
+static void BM_ChequeCalculerInteret (benchmark::State& p_etat)
+{
+  const Cheque cheque(PREMIER_NO_COMPTE, -1500.0, 0.5, static_cast<unsigned>(p_etat.range(0)), 0.1, "Compte courant");
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(cheque.calculerInteret());
+    }
+}
+BENCHMARK(BM_ChequeCalculerInteret)->Arg(5)->Arg(20)->Arg(30)->Arg(40);
+
+
+/**
+ * \brief Intérêt d'un compte épargne
+ */
+static void BM_EpargneCalculerInteret (benchmark::State& p_etat)
+{
+  const Epargne epargne(PREMIER_NO_COMPTE, 2500.0, 1.5, "Reer");
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(epargne.calculerInteret());
+    }
+}
+BENCHMARK(BM_EpargneCalculerInteret);
+
+
+/**
+ * \brief Ajout d'un nombre de jours à une date
+ */
+static void BM_DateAjouteNbJour (benchmark::State& p_etat)
+{
+  const int nbJours = static_cast<int>(p_etat.range(0));
+  util::Date date(1, 1, 2000);
+  for (auto _ : p_etat)
+    {
+      date.ajouteNbJour(nbJours);
+      date.ajouteNbJour(-nbJours);
+      benchmark::DoNotOptimize(date);
+    }
+}
+BENCHMARK(BM_DateAjouteNbJour)->Arg(1)->Arg(365)->Arg(36500);
+
+
+/**
+ * \brief Écart en jours entre deux dates
+ */
+static void BM_DateDifference (benchmark::State& p_etat)
+{
+  const util::Date debut(7, 9, 1988);
+  const util::Date fin(19, 10, 2026);
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(fin - debut);
+    }
+}
+BENCHMARK(BM_DateDifference);
+
+
+/**
+ * \brief Formatage d'une date dans une nouvelle chaîne
+ */
+static void BM_DateReqDateFormatee (benchmark::State& p_etat)
+{
+  const util::Date date(7, 9, 1988);
+  for (auto _ : p_etat)
+    {
+      string texte = date.reqDateFormatee();
+      benchmark::DoNotOptimize(texte.data());
+    }
+}
+BENCHMARK(BM_DateReqDateFormatee);
+
+
+/**
+ * \brief Formatage d'une date dans un tampon fourni
+ */
+static void BM_DateEcrireDateFormatee (benchmark::State& p_etat)
+{
+  const util::Date date(7, 9, 1988);
+  char tampon[64];
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(date.ecrireDateFormatee(tampon));
+    }
+}
+BENCHMARK(BM_DateEcrireDateFormatee);
+
+
+/**
+ * \brief Validation d'un nom ASCII et d'un nom accentué
+ */
+static void BM_ValiderFormatNom (benchmark::State& p_etat)
+{
+  const string nom = p_etat.range(0) == 0 ? "Dortelus" : "Dortélus-Bélanger";
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(util::validerFormatNom(nom));
+    }
+}
+BENCHMARK(BM_ValiderFormatNom)->Arg(0)->Arg(1);
+
+
+/**
+ * \brief Validation d'une colonne de N noms courts, ASCII seulement ou avec un nom
+ *        accentué sur seize, en octets de noms par seconde
+ */
+static void BM_ValiderColonneNoms (benchmark::State& p_etat)
+{
+  static const char* const NOMS[] = {"Tremblay", "Gagnon", "Roy", "Cote", "Bouchard", "Gauthier",
+                                     "Morin", "Lavoie", "Fortin", "Gagne", "Ouellet", "Pelletier",
+                                     "Belanger", "Jean-Pierre", "Bergeron", "Dortelus"};
+  const std::size_t nbrNoms = static_cast<std::size_t>(p_etat.range(0));
+  vector<string_view> colonne;
+  colonne.reserve(nbrNoms);
+  int64_t octets = 0;
+  for (std::size_t i = 0; i < nbrNoms; i++)
+    {
+      string_view nom = p_etat.range(1) != 0 && i % 16 == 0 ? "Bélanger" : NOMS[i % 16];
+      colonne.push_back(nom);
+      octets += static_cast<int64_t>(nom.size());
+    }
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(util::validerColonneNoms(colonne));
+    }
+  p_etat.SetBytesProcessed(p_etat.iterations() * octets);
+  p_etat.SetItemsProcessed(p_etat.iterations() * static_cast<int64_t>(nbrNoms));
+}
+BENCHMARK(BM_ValiderColonneNoms)->Args({1024, 0})->Args({65536, 0})->Args({65536, 1});
+
+
+/**
+ * \brief Validation d'une date au format JJ MM AAAA
+ */
+static void BM_ValiderFormatDate (benchmark::State& p_etat)
+{
+  int jour;
+  int mois;
+  int annee;
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(util::validerFormatDate("07 09 1988", jour, mois, annee));
+    }
+}
+BENCHMARK(BM_ValiderFormatDate);
+
+
+/**
+ * \brief Lecture d'un solde et d'un numéro de téléphone
+ */
+static void BM_LireNombres (benchmark::State& p_etat)
+{
+  double solde;
+  std::uint64_t noTelephone;
+  for (auto _ : p_etat)
+    {
+      benchmark::DoNotOptimize(util::lireSolde("-1234.56", solde));
+      benchmark::DoNotOptimize(util::lireTelephone("418 656-2131", noTelephone));
+    }
+}
+BENCHMARK(BM_LireNombres);
+
+
+/**
+ * \brief Validation d'un fichier client de N comptes
+ */
+static void BM_ValiderFormatFichier (benchmark::State& p_etat)
+{
+  string contenu = CLIENT_VALIDE;
+  for (int64_t i = 0; i < p_etat.range(0); i++)
+    {
+      contenu += "epargne\n" + to_string(PREMIER_NO_COMPTE + i) + "\n1.5\n2000\nReer\n0\n01 01 2020\n";
+    }
+  for (auto _ : p_etat)
+    {
+      istringstream entree(contenu);
+      benchmark::DoNotOptimize(util::validerFormatFichier(entree));
+    }
+  p_etat.SetBytesProcessed(p_etat.iterations() * contenu.size());
+  p_etat.SetComplexityN(p_etat.range(0));
+}
+BENCHMARK(BM_ValiderFormatFichier)->Apply(tailleClients)->Complexity();
+
+
+/**
+ * \brief Relevés de fin de mois des 9000 folios d'une banque de N comptes par client,
+ *        en un seul fichier, sur F fils (0 pour un fil par coeur)
+ *        Le fichier est /dev/null: la mesure exclut le coût du disque. La banque est
+ *        construite une fois, hors mesure.
+ */
+static void BM_TraitementReleves (benchmark::State& p_etat)
+{
+  ParametresGeneration parametres;
+  parametres.m_nbrClients = Banque::FOLIO_MAX - Banque::FOLIO_MIN;
+  parametres.m_distributionComptes = DistributionComptes::UNIFORME;
+  parametres.m_nbrComptesMin = static_cast<unsigned>(p_etat.range(0));
+  parametres.m_nbrComptesMax = static_cast<unsigned>(p_etat.range(0));
+  GenerateurClients generateur(parametres);
+  Banque banque;
+  for (std::uint64_t rang = 0; rang < parametres.m_nbrClients; rang++)
+    {
+      banque.ajouterClient(generateur.genererClient(rang));
+    }
+
+  const int descripteur = open("/dev/null", O_WRONLY);
+  TraitementReleves traitement(banque, static_cast<unsigned>(p_etat.range(1)));
+  StatistiquesReleves statistiques = {};
+  for (auto _ : p_etat)
+    {
+      statistiques = traitement.genererFichierUnique(descripteur);
+    }
+  close(descripteur);
+
+  p_etat.SetItemsProcessed(p_etat.iterations() * static_cast<int64_t>(statistiques.m_nbrClients));
+  p_etat.SetBytesProcessed(p_etat.iterations() * static_cast<int64_t>(statistiques.m_nbrOctets));
+  p_etat.counters["comptes"] = static_cast<double>(parametres.m_nbrClients * p_etat.range(0));
+  p_etat.counters["fils"] = traitement.reqNbFils();
+  p_etat.counters["p99_us"] = statistiques.m_latenceP99Microsecondes;
+}
+BENCHMARK(BM_TraitementReleves)->Args({16, 0})->Args({256, 1})->Args({256, 0})
+                               ->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(3);
+
+/**
+ * \brief Point d'entrée: sortie JSON par défaut dans BancEssaiPerformance.json
+ */
+int main (int argc, char** argv)
+{
+  vector<char*> arguments(argv, argv + argc);
+  bool sortieDemandee = false;
+  for (int i = 1; i < argc; i++)
+    {
+      sortieDemandee = sortieDemandee || strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+  char sortie[] = "--benchmark_out=BancEssaiPerformance.json";
+  char format[] = "--benchmark_out_format=json";
+  if (!sortieDemandee)
+    {
+      arguments.push_back(sortie);
+      arguments.push_back(format);
+    }
+  int nbrArguments = static_cast<int>(arguments.size());
+  benchmark::Initialize(&nbrArguments, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(nbrArguments, arguments.data()))
+    {
+      return 1;
+    }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * \file BanqueTesteur.cpp
+ * \brief Test unitaire de la classe Banque
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          Banque();
+ *          Banque(const Banque& p_banque);
+ *          void ajouterClient(const Client& p_client);
+ *          void supprimerClient(unsigned p_noFolio);
+ *          size_t reqNbrClients() const;
+ *          bool estClientPresent(unsigned p_noFolio) const;
+ *          const Client& reqClient(unsigned p_noFolio) const;
+ *          std::vector<const Client*> trouverParTelephone(std::uint64_t p_noTelephone) const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "Date.h"
+#include "Client.h"
+#include "Banque.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \class UneBanque
+ * \brief création d'une fixture pour des tests de la classe Banque
+ */
+class UneBanque: public::testing::Test
+{
+public:
+  UneBanque()
+    {
+      t_banque.ajouterClient(Client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999"));
+      t_banque.ajouterClient(Client(9999, "Doe", "John", util::Date(2, 7, 1974), "(333) 111-9999"));
+      t_banque.ajouterClient(Client(3333, "Roti", "Poulet", util::Date(7, 9, 1988), "3336669999"));
+    }
+  Banque t_banque;
+};
+
+
+/**
+ * \brief Test des méthodes void ajouterClient(const Client& p_client) et const Client& reqClient(unsigned p_noFolio) const
+ *        cas valide:
+ *          ajouterClient: les clients sont accessibles par leur folio
+ *        cas invalides:
+ *          ajouterClient_folioDejaPresent: un deuxième client sur le même folio
+ *          reqClient_absent: un folio sans client
+ */
+TEST_F(UneBanque, ajouterClient)
+{
+  ASSERT_EQ(t_banque.reqNbrClients(), 3);
+  ASSERT_TRUE(t_banque.estClientPresent(9999));
+  ASSERT_EQ(t_banque.reqClient(3333).reqNom(), "Roti");
+}
+TEST_F(UneBanque, ajouterClient_folioDejaPresent)
+{
+  ASSERT_THROW(t_banque.ajouterClient(Client(3333, "Li", "Samone", util::Date(3, 9, 2022), "123 4449999")),
+               PreconditionException);
+}
+TEST_F(UneBanque, reqClient_absent)
+{
+  ASSERT_FALSE(t_banque.estClientPresent(1002));
+  ASSERT_FALSE(t_banque.estClientPresent(10000));
+  ASSERT_THROW(t_banque.reqClient(1002), PreconditionException);
+}
+
+
+/**
+ * \brief Test de la méthode std::vector<const Client*> trouverParTelephone(std::uint64_t p_noTelephone) const
+ *        cas valides:
+ *          trouverParTelephone: les clients partageant un numéro, quel que soit le format saisi
+ *          trouverParTelephone_absent: un numéro non indexé
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UneBanque, trouverParTelephone)
+{
+  ASSERT_EQ(t_banque.trouverParTelephone(3331119999u).size(), 2);
+  ASSERT_EQ(t_banque.trouverParTelephone(3336669999u).front()->reqNoFolio(), 3333);
+}
+TEST_F(UneBanque, trouverParTelephone_absent)
+{
+  ASSERT_TRUE(t_banque.trouverParTelephone(1234449999u).empty());
+}
+
+
+/**
+ * \brief Test de la méthode void supprimerClient(unsigned p_noFolio)
+ *        cas valide:
+ *          supprimerClient: le client n'est plus présent ni indexé
+ *        cas invalide:
+ *          supprimerClient_absent: un folio sans client
+ */
+TEST_F(UneBanque, supprimerClient)
+{
+  t_banque.supprimerClient(1001);
+  ASSERT_FALSE(t_banque.estClientPresent(1001));
+  ASSERT_EQ(t_banque.reqNbrClients(), 2);
+  ASSERT_EQ(t_banque.trouverParTelephone(3331119999u).size(), 1);
+}
+TEST_F(UneBanque, supprimerClient_absent)
+{
+  ASSERT_THROW(t_banque.supprimerClient(1002), PreconditionException);
+}
+
+
+/**
+ * \brief Test du constructeur de copie Banque(const Banque& p_banque)
+ *        cas valide:
+ *          constructeurCopie: la copie est indépendante de l'original
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UneBanque, constructeurCopie)
+{
+  Banque copie(t_banque);
+  copie.supprimerClient(3333);
+  ASSERT_EQ(copie.reqNbrClients(), 2);
+  ASSERT_TRUE(t_banque.estClientPresent(3333));
+  ASSERT_EQ(copie.reqClient(9999).reqPrenom(), "John");
+}
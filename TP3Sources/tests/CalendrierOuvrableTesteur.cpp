@@ -0,0 +1,136 @@
+/**
+ * \file CalendrierOuvrableTesteur.cpp
+ * \brief Test unitaire de la classe CalendrierOuvrable
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          CalendrierOuvrable();
+ *          void ajouterJourFerie(const Date& p_date);
+ *          bool chargerJoursFeries(std::istream& p_is);
+ *          bool estJourOuvrable(const Date& p_date) const;
+ *          Date prochainJourOuvrable(const Date& p_date) const;
+ *          int nbJoursOuvrables(const Date& p_debut, const Date& p_fin) const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <sstream>
+
+#include "Date.h"
+#include "CalendrierOuvrable.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace util;
+
+/**
+ * \class UnCalendrier
+ * \brief création d'une fixture pour des tests de la classe CalendrierOuvrable
+ */
+class UnCalendrier: public::testing::Test
+{
+public:
+  CalendrierOuvrable t_calendrier;
+};
+
+
+/**
+ * \brief Test de la méthode bool estJourOuvrable(const Date& p_date) const
+ *        cas valides:
+ *          finDeSemaine: samedi et dimanche ne sont pas ouvrables, lundi l'est
+ *          bornesIntervalle: premier et dernier jour de l'intervalle
+ *        cas invalide:
+ *          horsIntervalle: une date avant 1970 ou après 2037
+ */
+TEST_F(UnCalendrier, finDeSemaine)
+{
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(18, 10, 2025)));
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(19, 10, 2025)));
+  ASSERT_TRUE(t_calendrier.estJourOuvrable(Date(20, 10, 2025)));
+}
+TEST_F(UnCalendrier, bornesIntervalle)
+{
+  ASSERT_TRUE(t_calendrier.estJourOuvrable(Date(1, 1, 1970)));
+  ASSERT_TRUE(t_calendrier.estJourOuvrable(Date(31, 12, 2037)));
+}
+TEST_F(UnCalendrier, horsIntervalle)
+{
+  ASSERT_THROW(t_calendrier.estJourOuvrable(Date(31, 12, 1969)), PreconditionException);
+  ASSERT_THROW(t_calendrier.estJourOuvrable(Date(1, 1, 2038)), PreconditionException);
+}
+
+
+/**
+ * \brief Test des méthodes void ajouterJourFerie(const Date& p_date) et bool chargerJoursFeries(std::istream& p_is)
+ *        cas valides:
+ *          ajouterJourFerie: un jour férié n'est plus ouvrable
+ *          chargerJoursFeries: chaque ligne valide est chargée
+ *        cas invalide:
+ *          chargerJoursFeries_ligneInvalide: les lignes valides sont chargées, le résultat est faux
+ */
+TEST_F(UnCalendrier, ajouterJourFerie)
+{
+  t_calendrier.ajouterJourFerie(Date(25, 12, 2025));
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(25, 12, 2025)));
+}
+TEST_F(UnCalendrier, chargerJoursFeries)
+{
+  istringstream feries("01 01 2025\n\n24 06 2025\n");
+  ASSERT_TRUE(t_calendrier.chargerJoursFeries(feries));
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(1, 1, 2025)));
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(24, 6, 2025)));
+}
+TEST_F(UnCalendrier, chargerJoursFeries_ligneInvalide)
+{
+  istringstream feries("01/07/2025\n01 09 2025\n");
+  ASSERT_FALSE(t_calendrier.chargerJoursFeries(feries));
+  ASSERT_TRUE(t_calendrier.estJourOuvrable(Date(1, 7, 2025)));
+  ASSERT_FALSE(t_calendrier.estJourOuvrable(Date(1, 9, 2025)));
+}
+
+
+/**
+ * \brief Test de la méthode Date prochainJourOuvrable(const Date& p_date) const
+ *        cas valides:
+ *          prochainJourOuvrable: un jour ouvrable est retourné tel quel, une fin de semaine
+ *                                suivie d'un jour férié est roulée au mardi
+ *          prochainJourOuvrable_changementMot: le roulement traverse une frontière de 64 jours
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnCalendrier, prochainJourOuvrable)
+{
+  t_calendrier.ajouterJourFerie(Date(1, 9, 2025));
+  ASSERT_EQ(t_calendrier.prochainJourOuvrable(Date(29, 8, 2025)), Date(29, 8, 2025));
+  ASSERT_EQ(t_calendrier.prochainJourOuvrable(Date(30, 8, 2025)), Date(2, 9, 2025));
+}
+TEST_F(UnCalendrier, prochainJourOuvrable_changementMot)
+{
+  for (int jour = 5; jour <= 31; jour++)
+    {
+      t_calendrier.ajouterJourFerie(Date(jour, 3, 1970));
+    }
+  ASSERT_EQ(t_calendrier.prochainJourOuvrable(Date(5, 3, 1970)), Date(1, 4, 1970));
+}
+
+
+/**
+ * \brief Test de la méthode int nbJoursOuvrables(const Date& p_debut, const Date& p_fin) const
+ *        cas valides:
+ *          nbJoursOuvrables: une semaine, une année complète, avec un jour férié
+ *        cas invalide:
+ *          nbJoursOuvrables_periodeInvalide: la fin précède le début
+ */
+TEST_F(UnCalendrier, nbJoursOuvrables)
+{
+  ASSERT_EQ(t_calendrier.nbJoursOuvrables(Date(20, 10, 2025), Date(27, 10, 2025)), 5);
+  ASSERT_EQ(t_calendrier.nbJoursOuvrables(Date(1, 1, 2025), Date(1, 1, 2026)), 261);
+  t_calendrier.ajouterJourFerie(Date(25, 12, 2025));
+  ASSERT_EQ(t_calendrier.nbJoursOuvrables(Date(1, 1, 2025), Date(1, 1, 2026)), 260);
+  ASSERT_EQ(t_calendrier.nbJoursOuvrables(Date(1, 1, 2025), Date(1, 1, 2025)), 0);
+}
+TEST_F(UnCalendrier, nbJoursOuvrables_periodeInvalide)
+{
+  ASSERT_THROW(t_calendrier.nbJoursOuvrables(Date(2, 1, 2025), Date(1, 1, 2025)), PreconditionException);
+}
@@ -14,6 +14,8 @@
  *          virtual std::string reqCompteFormate() const;  
  *          virtual std::unique_ptr<Compte> clone() const override;      
  *          static bool validerAttributsCheque(double p_tauxInteretMinimum, unsigned p_nombreTransations);
+ *          static std::optional<Cheque> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, unsigned p_nombreTransactions, 
+ *                                             double p_tauxInteretMinimum = 0.1, const std::string& p_description = "Cheque");
  */
 #include <stdlib.h>
 #include<gtest/gtest.h>
@@ -223,3 +225,28 @@ TEST_F(UnCompteCheque, clonePointeurCheque)
   std::unique_ptr<Compte> clonePtrCheque = t_compteCheque.clone();
   ASSERT_EQ(t_compteCheque.reqCompteFormate(), clonePtrCheque->reqCompteFormate());
 }
+
+
+/** 
+ * \brief Test de la méthode static std::optional<Cheque> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, 
+ *                                 unsigned p_nombreTransactions, double p_tauxInteretMinimum, const std::string& p_description)
+ *        cas valide:
+ *          creerValide: le compte fabriqué a les attributs passés en paramètres
+ *        cas invalides:
+ *          creerInvalide: numéro nul, transactions > 40, taux minimum >= taux, description vide; aucune exception
+ */
+TEST(Cheque, creerValide)
+{
+  std::optional<Cheque> compte = Cheque::creer(10, 100.0, 1.2, 20, 0.2, "Courant");
+  ASSERT_TRUE(compte.has_value());
+  ASSERT_EQ(10, compte->reqNoCompte());
+  ASSERT_EQ(20, compte->reqNbrTransactions());
+  ASSERT_EQ("Courant", compte->reqDescription());
+}
+TEST(Cheque, creerInvalide)
+{
+  ASSERT_FALSE(Cheque::creer(0, 100.0, 1.2, 20).has_value());
+  ASSERT_FALSE(Cheque::creer(10, 100.0, 1.2, 41).has_value());
+  ASSERT_FALSE(Cheque::creer(10, 100.0, 1.2, 20, 1.2).has_value());
+  ASSERT_FALSE(Cheque::creer(10, 100.0, 1.2, 20, 0.1, "").has_value());
+}
@@ -9,21 +9,38 @@
  *                  const util::Date& p_dateNaissance, const std::string& p_telephone);             
  *          Client(const Client& p_client);               
  *          Client& operator=(const Client& p_client);  
+ *          Client& operator=(Client&& p_client);
  *          unsigned reqNoFolio() const;
  *          const std::string reqTelephone() const;   
  *          const std::string reqNom() const;
  *          const std::string reqPrenom() const;
  *          const std::string reqDateNaissance() const;
- *          size_t reqNbrComptes() const;                                       
+ *          size_t reqNbrComptes() const;
+ *          const Compte& reqCompte(size_t p_rang) const;
+ *          const util::Date& reqDateNaissanceRef() const;                                       
+ *          std::string_view reqNomVue() const;
+ *          std::string_view reqPrenomVue() const;
+ *          std::string_view reqTelephoneVue() const;
  *          bool operator<(const Client& p_noFolio) const; 
  *          std::string reqClientFormate() const;
  *          std::string reqReleves() const;
  *          static bool validerAttributsClient(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom,
  *                                             const util::Date& p_dateNaissance, const std::string& p_telephone);
  *          std::string reqTelephoneFormate() const;
+ *          std::uint64_t reqNoTelephone() const;
+ *          static void formaterTelephone(std::uint64_t p_noTelephone, char* p_tampon);
  * 
  *          void ajouterCompte (const Compte& p_nouveauCompte);
  *          void supprimerCompte (int p_noCompte);
+ *          ResultatCompte essayerAjouterCompte (const Compte& p_nouveauCompte);
+ *          ResultatCompte essayerSupprimerCompte (int p_noCompte);
+ *          std::size_t essayerAjouterComptes (std::vector<std::unique_ptr<Compte>>&& p_nouveauxComptes);
+ *          std::size_t supprimerComptes (unsigned p_noPremier, unsigned p_noDernier);
+ *          static std::optional<Client> creer(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom,
+ *                                             const util::Date& p_dateNaissance, const std::string& p_telephone);
+ *          static std::optional<util::Date> util::Date::creer(int p_jour, int p_mois, int p_annee);
+ *          Client(const Client& p_client, std::pmr::memory_resource* p_ressource);
+ *          std::pmr::memory_resource* reqRessource() const;
  * 
  * 
  */
@@ -31,6 +48,7 @@
 #include<gtest/gtest.h>
 
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <sstream>
 
@@ -45,6 +63,37 @@
 using namespace std; 
 using namespace bancaire;
 
+namespace
+{
+/**
+ * \class RessourceComptee
+ * \brief Ressource mémoire qui compte ses allocations et les octets non rendus
+ */
+class RessourceComptee : public pmr::memory_resource
+{
+public:
+  size_t m_nbAllocations = 0;
+  size_t m_octetsEnCours = 0;
+
+private:
+  void* do_allocate (size_t p_taille, size_t p_alignement) override
+  {
+    m_nbAllocations++;
+    m_octetsEnCours += p_taille;
+    return pmr::new_delete_resource()->allocate(p_taille, p_alignement);
+  }
+  void do_deallocate (void* p_bloc, size_t p_taille, size_t p_alignement) override
+  {
+    m_octetsEnCours -= p_taille;
+    pmr::new_delete_resource()->deallocate(p_bloc, p_taille, p_alignement);
+  }
+  bool do_is_equal (const pmr::memory_resource& p_autre) const noexcept override
+  {
+    return this == &p_autre;
+  }
+};
+}
+
 /**    
  * \brief Test du constructeur avec paramètres Client(unsigned p_noFolio, const std::string& p_nom, const std::string& p_prenom, 
  *                                                    const util::Date& p_dateNaissance, const std::string& p_telephone)
@@ -235,6 +284,19 @@ TEST_F(UnClient, reqTelephone)
 }
 
 
+/** 
+ * \brief Test de la méthode std::uint64_t reqNoTelephone() const
+ *        cas valide:
+ *          reqNoTelephone: le numéro est normalisé en entier à la construction
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClient, reqNoTelephone)
+{
+  ASSERT_EQ(1234449999u, t_unClient.reqNoTelephone());
+}
+
+
 /** 
  * \brief Test de la méthode const std::string reqNom() const
  *        cas valide:
@@ -261,6 +323,22 @@ TEST_F(UnClient, reqPrenom)
 }
 
 
+/** 
+ * \brief Test des méthodes reqNomVue, reqPrenomVue et reqTelephoneVue
+ *        cas valide:
+ *          accesseursVue: mêmes valeurs que les accesseurs par copie, vues sur les attributs du client
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClient, accesseursVue)
+{
+  ASSERT_EQ(t_unClient.reqNom(), t_unClient.reqNomVue());
+  ASSERT_EQ(t_unClient.reqPrenom(), t_unClient.reqPrenomVue());
+  ASSERT_EQ(t_unClient.reqTelephone(), t_unClient.reqTelephoneVue());
+  ASSERT_EQ(t_unClient.reqNomVue().data(), t_unClient.reqNomVue().data());
+}
+
+
 /** 
  * \brief Test de la méthode const std::string reqDateNaissance() const
  *        cas valide:
@@ -287,6 +365,26 @@ TEST_F(UnClient, reqTelephoneFormate)
 }
 
 
+/** 
+ * \brief Test de la méthode static void formaterTelephone(std::uint64_t p_noTelephone, char* p_tampon)
+ *        cas valide:
+ *          formaterTelephone: les zéros de tête sont conservés, seuls les 10 derniers chiffres
+ *                             d'un numéro plus long sont écrits
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST(Client, formaterTelephone)
+{
+  char tampon[Client::TAILLE_TELEPHONE_FORMATE];
+  Client::formaterTelephone(123456789u, tampon);
+  ASSERT_EQ("012 345-6789", std::string(tampon, Client::TAILLE_TELEPHONE_FORMATE));
+  Client::formaterTelephone(0u, tampon);
+  ASSERT_EQ("000 000-0000", std::string(tampon, Client::TAILLE_TELEPHONE_FORMATE));
+  Client::formaterTelephone(18005550100u, tampon);
+  ASSERT_EQ("800 555-0100", std::string(tampon, Client::TAILLE_TELEPHONE_FORMATE));
+}
+
+
 /** 
  * \brief Test de la méthode std::string reqClientFormate() const
  *        cas valide:
@@ -418,4 +516,229 @@ TEST_F(UnClient, SupprimerCompte_Valide)
 TEST_F(UnClient, SupprimerCompte_Absent_Exception)
 {
   ASSERT_THROW(t_unClient.supprimerCompte(12345), CompteAbsentException);
-}
\ No newline at end of file
+}
+/**
+ * \brief Test des méthodes ResultatCompte essayerAjouterCompte (const Compte& p_nouveauCompte)
+ *        et ResultatCompte essayerSupprimerCompte (int p_noCompte)
+ *     Cas valides:
+ *       ajout puis suppression d'un compte, SUCCES retourné
+ *     Cas invalides:
+ *       doublon et compte absent rapportés sans exception, comptes inchangés
+ */
+TEST_F(UnClient, EssayerAjouterSupprimer_Valide)
+{
+  Cheque compte1(12345, 1000.0, 0.5, 33);
+
+  ASSERT_EQ(ResultatCompte::SUCCES, t_unClient.essayerAjouterCompte(compte1));
+  ASSERT_EQ(1, t_unClient.reqNbrComptes());
+  ASSERT_EQ(ResultatCompte::SUCCES, t_unClient.essayerSupprimerCompte(12345));
+  ASSERT_EQ(0, t_unClient.reqNbrComptes());
+}
+
+TEST_F(UnClient, EssayerAjouterSupprimer_Invalide)
+{
+  Cheque compte1(12345, 1000.0, 0.5, 33);
+  t_unClient.ajouterCompte(compte1);
+
+  ASSERT_EQ(ResultatCompte::COMPTE_DEJA_PRESENT, t_unClient.essayerAjouterCompte(compte1));
+  ASSERT_EQ(ResultatCompte::COMPTE_ABSENT, t_unClient.essayerSupprimerCompte(54321));
+  ASSERT_EQ(1, t_unClient.reqNbrComptes());
+}
+
+/**
+ * \brief Test des méthodes std::size_t essayerAjouterComptes (std::vector<std::unique_ptr<Compte>>&& p_nouveauxComptes)
+ *        et std::size_t supprimerComptes (unsigned p_noPremier, unsigned p_noDernier)
+ *     Cas valides:
+ *       lot ajouté dans l'ordre, plage supprimée en conservant l'ordre des autres comptes
+ *     Cas invalides:
+ *       doublons du client et du lot ignorés, plage inversée
+ */
+TEST_F(UnClient, AjouterSupprimerComptes_Valide)
+{
+  vector<unique_ptr<Compte>> lot;
+  for (unsigned no = 10; no < 20; no++)
+    {
+      lot.push_back(Cheque(no, 100.0, 0.5, 3).clone());
+    }
+  ASSERT_EQ(10, t_unClient.essayerAjouterComptes(std::move(lot)));
+  ASSERT_TRUE(lot.empty());
+  ASSERT_EQ(10, t_unClient.reqNbrComptes());
+  ASSERT_EQ(10, t_unClient.reqCompte(0).reqNoCompte());
+  ASSERT_EQ(19, t_unClient.reqCompte(9).reqNoCompte());
+
+  ASSERT_EQ(3, t_unClient.supprimerComptes(12, 14));
+  ASSERT_EQ(7, t_unClient.reqNbrComptes());
+  ASSERT_EQ(11, t_unClient.reqCompte(1).reqNoCompte());
+  ASSERT_EQ(15, t_unClient.reqCompte(2).reqNoCompte());
+  ASSERT_EQ(0, t_unClient.supprimerComptes(100, 200));
+}
+
+TEST_F(UnClient, AjouterSupprimerComptes_Invalide)
+{
+  t_unClient.ajouterCompte(Cheque(10, 100.0, 0.5, 3));
+  vector<unique_ptr<Compte>> lot;
+  lot.push_back(Cheque(10, 200.0, 0.5, 3).clone());
+  lot.push_back(Cheque(11, 200.0, 0.5, 3).clone());
+  lot.push_back(Cheque(11, 300.0, 0.5, 3).clone());
+
+  ASSERT_EQ(1, t_unClient.essayerAjouterComptes(std::move(lot)));
+  ASSERT_EQ(2, t_unClient.reqNbrComptes());
+  ASSERT_EQ(100.0, t_unClient.reqCompte(0).reqSolde());
+  ASSERT_EQ(200.0, t_unClient.reqCompte(1).reqSolde());
+  ASSERT_THROW(t_unClient.supprimerComptes(20, 10), PreconditionException);
+}
+
+
+/**
+ * \brief Test des fabriques static std::optional<Client> creer(...) et static std::optional<util::Date> util::Date::creer(...)
+ *     Cas valides:
+ *       client et date fabriqués avec les attributs passés en paramètres
+ *     Cas invalides:
+ *       folio, nom, téléphone ou date invalides rapportés sans exception
+ */
+TEST(Client, creerValide)
+{
+  std::optional<Client> client = Client::creer(1001, "Doe", "Jane", util::Date(02, 07, 1972), "333 111 9999");
+  ASSERT_TRUE(client.has_value());
+  ASSERT_EQ(client->reqNoFolio(), 1001);
+  ASSERT_EQ(client->reqNoTelephone(), 3331119999ULL);
+  ASSERT_EQ(client->reqTelephone(), "333 111 9999");
+
+  std::optional<util::Date> date = util::Date::creer(29, 2, 2024);
+  ASSERT_TRUE(date.has_value());
+  ASSERT_EQ(*date, util::Date(29, 2, 2024));
+}
+
+TEST(Client, creerInvalide)
+{
+  ASSERT_FALSE(Client::creer(999, "Doe", "Jane", util::Date(02, 07, 1972), "333 111 9999").has_value());
+  ASSERT_FALSE(Client::creer(1001, "D0e", "Jane", util::Date(02, 07, 1972), "333 111 9999").has_value());
+  ASSERT_FALSE(Client::creer(1001, "Doe", "Jane", util::Date(02, 07, 1972), "333 111").has_value());
+  ASSERT_FALSE(util::Date::creer(29, 2, 2023).has_value());
+  ASSERT_FALSE(util::Date::creer(1, 13, 2023).has_value());
+}
+
+
+/**
+ * \brief Test des méthodes const Compte& reqCompte(size_t p_rang) const et const util::Date& reqDateNaissanceRef() const
+ *     Cas valide:
+ *       comptes retournés dans l'ordre d'ajout, date de naissance non formatée
+ *     Cas invalide:
+ *       rang hors limites
+ */
+TEST_F(UnClient, ReqCompte_Valide)
+{
+  t_unClient.ajouterCompte(Cheque(12345, 1000.0, 0.5, 33));
+  t_unClient.ajouterCompte(Epargne(22, 22.22, 0.3));
+
+  ASSERT_EQ(12345, t_unClient.reqCompte(0).reqNoCompte());
+  ASSERT_EQ(22, t_unClient.reqCompte(1).reqNoCompte());
+  ASSERT_EQ(t_unClient.reqDateNaissance(), t_unClient.reqDateNaissanceRef().reqDateFormatee());
+}
+
+TEST_F(UnClient, ReqCompte_RangInvalide)
+{
+  ASSERT_THROW(t_unClient.reqCompte(0), PreconditionException);
+}
+
+
+/**
+ * \brief Test de l'allocation des comptes dans une ressource mémoire
+ *     Cas valides:
+ *       ressourceComptes: comptes, descriptions et vecteur pris dans la ressource et tous rendus
+ *       copieDansRessource: la copie dans une arène donne les mêmes relevés, la copie simple utilise le monceau
+ *       ajouterComptesDansRessource: un lot est copié dans la ressource, les doublons ignorés
+ *       deplacementMemeRessource: les comptes sont repris sans copie
+ *       deplacementAutreRessource: les comptes sont copiés dans la ressource du client
+ *                                  cible et survivent à l'arène du client déplacé
+ *     Cas invalide:
+ *       ressourceNulle: ressource nulle à la construction ou à la copie
+ */
+TEST(Client, ressourceComptes)
+{
+  RessourceComptee ressource;
+  {
+    Client client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999", &ressource);
+    ASSERT_EQ(client.reqRessource(), &ressource);
+    client.ajouterCompte(Cheque(10, -100.0, 2.0, 5, 0.5, "Compte courant du ménage familial"));
+    client.ajouterCompte(Epargne(20, 100.0, 1.5, "Épargne pour les études des enfants"));
+    ASSERT_GE(ressource.m_nbAllocations, 5);
+
+    Client surLeMonceau(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999");
+    surLeMonceau.ajouterCompte(Cheque(10, -100.0, 2.0, 5, 0.5, "Compte courant du ménage familial"));
+    surLeMonceau.ajouterCompte(Epargne(20, 100.0, 1.5, "Épargne pour les études des enfants"));
+    ASSERT_EQ(client.reqReleves(), surLeMonceau.reqReleves());
+
+    client.supprimerCompte(10);
+    ASSERT_EQ(client.reqNbrComptes(), 1);
+  }
+  ASSERT_EQ(ressource.m_octetsEnCours, 0);
+}
+TEST(Client, copieDansRessource)
+{
+  Client original(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999");
+  for (unsigned i = 1; i <= 50; i++)
+    {
+      original.ajouterCompte(Cheque(i, -10.0 * i, 2.0, i % 40, 0.5, "Compte courant du ménage familial"));
+    }
+  pmr::monotonic_buffer_resource arene;
+  Client copie(original, &arene);
+  ASSERT_EQ(copie.reqRessource(), &arene);
+  ASSERT_EQ(copie.reqReleves(), original.reqReleves());
+  original.supprimerCompte(1);
+  ASSERT_EQ(copie.reqNbrComptes(), 50);
+
+  Client copieSimple(copie);
+  ASSERT_EQ(copieSimple.reqRessource(), pmr::get_default_resource());
+  ASSERT_EQ(copieSimple.reqReleves(), copie.reqReleves());
+}
+TEST(Client, ajouterComptesDansRessource)
+{
+  RessourceComptee ressource;
+  Client client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999", &ressource);
+  client.ajouterCompte(Epargne(20, 100.0, 1.5));
+  vector<unique_ptr<Compte>> lot;
+  lot.push_back(make_unique<Cheque>(10, -100.0, 2.0, 5, 0.5, "Compte courant du ménage familial"));
+  lot.push_back(make_unique<Epargne>(20, 50.0, 1.0));
+  const size_t nbAllocationsAvant = ressource.m_nbAllocations;
+  ASSERT_EQ(client.essayerAjouterComptes(std::move(lot)), 1);
+  ASSERT_GT(ressource.m_nbAllocations, nbAllocationsAvant);
+  ASSERT_EQ(client.reqCompte(1).reqDescription(), "Compte courant du ménage familial");
+}
+TEST(Client, deplacementMemeRessource)
+{
+  RessourceComptee ressource;
+  Client source(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999", &ressource);
+  source.ajouterCompte(Cheque(10, -100.0, 2.0, 5, 0.5, "Compte courant du ménage familial"));
+  const Compte* compte = &source.reqCompte(0);
+  Client cible(1002, "Roe", "John", util::Date(3, 8, 1975), "418 656-2131", &ressource);
+  const size_t nbAllocationsAvant = ressource.m_nbAllocations;
+
+  cible = std::move(source);
+  ASSERT_EQ(ressource.m_nbAllocations, nbAllocationsAvant);
+  ASSERT_EQ(&cible.reqCompte(0), compte);
+  ASSERT_EQ(cible.reqNoFolio(), 1001);
+}
+TEST(Client, deplacementAutreRessource)
+{
+  Client cible(1002, "Roe", "John", util::Date(3, 8, 1975), "418 656-2131");
+  string releves;
+  {
+    pmr::monotonic_buffer_resource arene;
+    Client source(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999", &arene);
+    source.ajouterCompte(Cheque(10, -100.0, 2.0, 5, 0.5, "Compte courant du ménage familial"));
+    source.ajouterCompte(Epargne(20, 100.0, 1.5, "Épargne pour les études des enfants"));
+    releves = source.reqReleves();
+
+    cible = std::move(source);
+    ASSERT_EQ(cible.reqRessource(), pmr::get_default_resource());
+  }
+  ASSERT_EQ(cible.reqNbrComptes(), 2);
+  ASSERT_EQ(cible.reqReleves(), releves);
+}
+TEST(Client, ressourceNulle)
+{
+  ASSERT_THROW(Client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999", nullptr), PreconditionException);
+  Client client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999");
+  ASSERT_THROW(Client(client, nullptr), PreconditionException);
+}
@@ -12,6 +12,7 @@
  *          double reqSolde () const;
  *          const std::string reqDescription() const;
  *          const std::string reqDateOuverture() const;
+ *          std::string_view reqDescriptionVue() const;
  *          void asgTauxInteret(double p_tauxInteret);
  *          void asgSolde(double p_solde);
  *          void asgDescription(const std::string& p_description); 
@@ -197,6 +198,21 @@ TEST_F(UnCompte, reqDescriptions)
 }
 
 
+/**
+ * \brief Test de la méthode std::string_view reqDescriptionVue() const
+ *        cas valide:
+ *          reqDescriptionVue: même valeur que reqDescription, suit asgDescription
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnCompte, reqDescriptionVue)
+{
+  ASSERT_EQ(t_compte.reqDescription(), t_compte.reqDescriptionVue());
+  t_compte.asgDescription("changeons la description");
+  ASSERT_EQ("changeons la description", t_compte.reqDescriptionVue());
+}
+
+
 /**
  * \brief Test de la méthode const std::string reqDateOuverture() const;
  *        cas valide:
@@ -0,0 +1,202 @@
+/**
+ * \file CompteurAllocations.h
+ * \brief Comptage des allocations sur le monceau par remplacement de l'opérateur new global.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ *
+ * Ce fichier remplace les opérateurs new et delete globaux: il doit être inclus
+ * dans un seul fichier source de l'exécutable de test. Seules les allocations du
+ * fil qui mesure, pendant la mesure, sont comptées; celles de gtest ou des autres
+ * fils ne le sont pas. Les formes alignées (std::align_val_t), utilisées pour les
+ * types sur-alignés et par std::pmr::new_delete_resource(), sont comptées aussi.
+ */
+
+#ifndef COMPTEURALLOCATIONS_H
+#define COMPTEURALLOCATIONS_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace essai
+{
+/**
+ * \struct Allocations
+ * \brief Nombre d'allocations et d'octets alloués pendant une mesure
+ */
+struct Allocations
+{
+  std::uint64_t m_nbAllocations;
+  std::uint64_t m_nbOctets;
+};
+
+
+/**
+ * \class CompteurAllocations
+ * \brief Compte les allocations du fil courant pendant la durée de vie de l'objet
+ */
+class CompteurAllocations
+{
+public:
+  CompteurAllocations () : m_precedent(s_courant)
+  {
+    m_allocations = {0, 0};
+    s_courant = &m_allocations;
+  }
+
+  ~CompteurAllocations ()
+  {
+    s_courant = m_precedent;
+  }
+
+  CompteurAllocations (const CompteurAllocations&) = delete;
+  CompteurAllocations& operator= (const CompteurAllocations&) = delete;
+
+  Allocations reqAllocations () const
+  {
+    return m_allocations;
+  }
+
+  /**
+   * \brief Appelé par l'opérateur new remplacé pour chaque allocation
+   */
+  static void noter (std::size_t p_taille)
+  {
+    if (s_courant != nullptr)
+      {
+        s_courant->m_nbAllocations++;
+        s_courant->m_nbOctets += p_taille;
+      }
+  }
+
+private:
+  Allocations m_allocations;
+  Allocations* m_precedent;
+
+  static inline thread_local Allocations* s_courant = nullptr;
+};
+
+
+/**
+ * \brief Exécute une opération et retourne les allocations qu'elle a faites sur le fil courant
+ * \param[in] p_operation l'opération à mesurer
+ */
+template <typename Operation>
+Allocations compterAllocations (Operation&& p_operation)
+{
+  CompteurAllocations compteur;
+  p_operation();
+  return compteur.reqAllocations();
+}
+
+} // namespace essai
+
+
+// --- Opérateurs globaux remplacés
+//
+// GCC associe free() à malloc() seulement et signale à tort chaque delete inliné.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new (std::size_t p_taille)
+{
+  essai::CompteurAllocations::noter(p_taille);
+  if (void* bloc = std::malloc(p_taille == 0 ? 1 : p_taille))
+    {
+      return bloc;
+    }
+  throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t p_taille)
+{
+  return ::operator new(p_taille);
+}
+
+void* operator new (std::size_t p_taille, const std::nothrow_t&) noexcept
+{
+  essai::CompteurAllocations::noter(p_taille);
+  return std::malloc(p_taille == 0 ? 1 : p_taille);
+}
+
+void* operator new[] (std::size_t p_taille, const std::nothrow_t& p_nothrow) noexcept
+{
+  return ::operator new(p_taille, p_nothrow);
+}
+
+void operator delete (void* p_bloc) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete[] (void* p_bloc) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete (void* p_bloc, std::size_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete[] (void* p_bloc, std::size_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+void* operator new (std::size_t p_taille, std::align_val_t p_alignement, const std::nothrow_t&) noexcept
+{
+  essai::CompteurAllocations::noter(p_taille);
+  const std::size_t alignement = static_cast<std::size_t>(p_alignement);
+  void* bloc = nullptr;
+  if (::posix_memalign(&bloc, alignement < sizeof(void*) ? sizeof(void*) : alignement, p_taille == 0 ? 1 : p_taille) != 0)
+    {
+      return nullptr;
+    }
+  return bloc;
+}
+
+void* operator new (std::size_t p_taille, std::align_val_t p_alignement)
+{
+  if (void* bloc = ::operator new(p_taille, p_alignement, std::nothrow))
+    {
+      return bloc;
+    }
+  throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t p_taille, std::align_val_t p_alignement)
+{
+  return ::operator new(p_taille, p_alignement);
+}
+
+void* operator new[] (std::size_t p_taille, std::align_val_t p_alignement, const std::nothrow_t& p_nothrow) noexcept
+{
+  return ::operator new(p_taille, p_alignement, p_nothrow);
+}
+
+void operator delete (void* p_bloc, std::align_val_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete[] (void* p_bloc, std::align_val_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete (void* p_bloc, std::size_t, std::align_val_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+void operator delete[] (void* p_bloc, std::size_t, std::align_val_t) noexcept
+{
+  std::free(p_bloc);
+}
+
+#pragma GCC diagnostic pop
+
+#endif /* COMPTEURALLOCATIONS_H */
@@ -0,0 +1,123 @@
+/**
+ * \file EchantillonnageBibliothequeTesteur.cpp
+ * \brief Test de la vérification échantillonnée des invariants des classes de la bibliothèque
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          void Compte::verifieInvariant() const;
+ *          void Cheque::verifieInvariant() const;
+ *          void Epargne::verifieInvariant() const;
+ *          void Client::verifieInvariant() const;
+ *          void Date::verifieInvariant() const;
+ *          static std::uint64_t EchantillonnageInvariants::reqNbVerifications();
+ *          static std::uint64_t EchantillonnageInvariants::reqNbViolations();
+ *
+ * Ce test et la bibliothèque qu'il lie se compilent dans la configuration
+ * Echantillonnage: CONTRAT_NIVEAU_AUCUN et CONTRAT_ECHANTILLONNAGE, comme une
+ * version de production surveillée.
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "ContratException.h"
+
+#if !defined(CONTRAT_ECHANTILLONNAGE) || CONTRAT_NIVEAU != CONTRAT_NIVEAU_AUCUN
+#error "EchantillonnageBibliothequeTesteur se compile dans la configuration Echantillonnage"
+#endif
+
+using namespace std;
+using namespace bancaire;
+
+namespace
+{
+/**
+ * \brief Opérations courantes sur des dates, des comptes et un client, toutes valides
+ */
+void operationsCourantes ()
+{
+  util::Date date(7, 9, 1988);
+  date.asgDate(8, 9, 1988);
+  Client client(3333, "Dortelus", "Judith", date, "418 656-2131");
+  Cheque cheque(20, 100.5, 2.3, 3, 0.1, "Compte courant");
+  cheque.asgSolde(200.0);
+  client.ajouterCompte(cheque);
+  client.ajouterCompte(Epargne(21, 2000.0, 1.5, "Reer"));
+  client.supprimerCompte(20);
+  Client copie(client);
+}
+}
+
+/**
+ * \class UnEchantillonnage
+ * \brief création d'une fixture: compteurs remis à zéro, période rétablie après le test
+ */
+class UnEchantillonnage: public::testing::Test
+{
+public:
+  UnEchantillonnage ()
+  {
+    EchantillonnageInvariants::asgPeriode(1);
+    EchantillonnageInvariants::reinitialiserCompteurs();
+  }
+  ~UnEchantillonnage ()
+  {
+    EchantillonnageInvariants::asgPeriode(EchantillonnageInvariants::PERIODE_DEFAUT);
+  }
+};
+
+
+/**
+ * \brief Test de la vérification échantillonnée des invariants de la bibliothèque
+ *        cas valides:
+ *          unAppelSurN: à la période 10, dix répétitions des opérations vérifient autant
+ *                       d'invariants qu'une seule répétition à la période 1, sans violation
+ *        cas invalide:
+ *          violationsComptees: Date, Compte, Cheque, Epargne et Client invalides, chaque
+ *                              violation est comptée sans exception
+ */
+TEST_F(UnEchantillonnage, unAppelSurN)
+{
+  operationsCourantes();
+  const uint64_t nbAppels = EchantillonnageInvariants::reqNbVerifications();
+  ASSERT_GT(nbAppels, 10);
+
+  EchantillonnageInvariants::asgPeriode(10);
+  EchantillonnageInvariants::reinitialiserCompteurs();
+  for (int i = 0; i < 10; i++)
+    {
+      operationsCourantes();
+    }
+  ASSERT_EQ(EchantillonnageInvariants::reqNbVerifications(), nbAppels);
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 0);
+}
+TEST_F(UnEchantillonnage, violationsComptees)
+{
+  ASSERT_NO_THROW(util::Date(31, 2, 2021));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 1);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(), "Date::validerDate (m_jour, m_mois, m_annee)");
+
+  ASSERT_NO_THROW(Epargne(21, 10.0, 1.5, ""));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 2);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(),
+               "Compte::validerAttributs(m_noCompte, m_tauxInteret, m_description)");
+
+  ASSERT_NO_THROW(Cheque(20, 100.5, 2.3, 50, 0.1, "Compte courant"));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 3);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(),
+               "Cheque::validerAttributsCheque(reqTauxInteretMinimum(), reqNbrTransactions())");
+
+  ASSERT_NO_THROW(Epargne(21, -10.0, 1.5, "Reer"));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 4);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(),
+               "Epargne::validerAttributsEpargne(reqSolde(), reqTauxInteret())");
+
+  ASSERT_NO_THROW(Client(5, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131"));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 5);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(),
+               "Client::validerIdentite(m_noFolio, m_nom, m_prenom, m_dateNaissance)");
+}
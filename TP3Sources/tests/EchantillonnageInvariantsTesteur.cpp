@@ -0,0 +1,109 @@
+/**
+ * \file EchantillonnageInvariantsTesteur.cpp
+ * \brief Test unitaire de la vérification des invariants par échantillonnage
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          static void asgPeriode(unsigned p_periode);
+ *          static bool doitVerifier();
+ *          static std::uint64_t reqNbVerifications();
+ *          static std::uint64_t reqNbViolations();
+ *          static const char* reqDerniereViolation();
+ *          static void reinitialiserCompteurs();
+ */
+#undef CONTRAT_NIVEAU
+#define CONTRAT_NIVEAU CONTRAT_NIVEAU_AUCUN
+#define CONTRAT_ECHANTILLONNAGE
+
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "ContratException.h"
+
+using namespace std;
+
+namespace
+{
+/**
+ * \class Compteur
+ * \brief Classe minimale dont l'invariant peut être brisé volontairement
+ */
+class Compteur
+{
+public:
+  explicit Compteur (int p_valeur) : m_valeur(p_valeur) { }
+  void asgValeur (int p_valeur)
+  {
+    m_valeur = p_valeur;
+    INVARIANTS();
+  }
+private:
+  void verifieInvariant () const
+  {
+    INVARIANT (m_valeur >= 0);
+  }
+  int m_valeur;
+};
+}
+
+/**
+ * \class UnEchantillonnage
+ * \brief création d'une fixture: période de 10 et compteurs remis à zéro
+ */
+class UnEchantillonnage: public::testing::Test
+{
+public:
+  UnEchantillonnage ()
+  {
+    EchantillonnageInvariants::asgPeriode(10);
+    EchantillonnageInvariants::reinitialiserCompteurs();
+  }
+  ~UnEchantillonnage ()
+  {
+    EchantillonnageInvariants::asgPeriode(EchantillonnageInvariants::PERIODE_DEFAUT);
+  }
+  Compteur t_compteur {0};
+};
+
+
+/**
+ * \brief Test de la vérification échantillonnée des invariants
+ *        cas valides:
+ *          unAppelSurN: 100 appels vérifient 10 fois l'invariant
+ *          periodeNulle: aucune vérification
+ *        cas invalide:
+ *          violationComptee: l'invariant brisé est compté sans exception
+ */
+TEST_F(UnEchantillonnage, unAppelSurN)
+{
+  for (int i = 0; i < 100; i++)
+    {
+      t_compteur.asgValeur(i);
+    }
+  ASSERT_EQ(EchantillonnageInvariants::reqNbVerifications(), 10);
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 0);
+  ASSERT_EQ(EchantillonnageInvariants::reqDerniereViolation(), nullptr);
+}
+TEST_F(UnEchantillonnage, periodeNulle)
+{
+  EchantillonnageInvariants::asgPeriode(0);
+  for (int i = 0; i < 100; i++)
+    {
+      t_compteur.asgValeur(-1);
+    }
+  ASSERT_EQ(EchantillonnageInvariants::reqPeriode(), 0);
+  ASSERT_EQ(EchantillonnageInvariants::reqNbVerifications(), 0);
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 0);
+}
+TEST_F(UnEchantillonnage, violationComptee)
+{
+  EchantillonnageInvariants::asgPeriode(1);
+  ASSERT_NO_THROW(t_compteur.asgValeur(-1));
+  ASSERT_NO_THROW(t_compteur.asgValeur(-2));
+  ASSERT_EQ(EchantillonnageInvariants::reqNbVerifications(), 2);
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 2);
+  ASSERT_STREQ(EchantillonnageInvariants::reqDerniereViolation(), "m_valeur >= 0");
+  EchantillonnageInvariants::reinitialiserCompteurs();
+  ASSERT_EQ(EchantillonnageInvariants::reqNbViolations(), 0);
+}
@@ -10,6 +10,10 @@
  *          virtual std::unique_ptr<Compte> clone() const override;
  *          virtual std::string reqCompteFormate() const;
  *          static bool validerAttributsEpargne(double p_solde, double p_tauxInteret); 
+ *          static std::optional<Epargne> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description = "Epargne",
+ *                                              const util::Date& p_dateOuverture = util::Date());
+ *          static std::optional<Epargne> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, const std::string& p_description = "Epargne",
+ *                                              const util::Date& p_dateOuverture = util::Date());
  */
 #include <stdlib.h>
 #include<gtest/gtest.h>
@@ -150,3 +154,26 @@ TEST_F(UnCompteEpargne, clonePointeurEpargne)
   std::unique_ptr<Compte> clonePtrEpargne = t_compteEpargne.clone();
   ASSERT_EQ(t_compteEpargne.reqCompteFormate(), clonePtrEpargne->reqCompteFormate());
 }
+
+
+/** 
+ * \brief Test de la méthode static std::optional<Epargne> creer(unsigned p_noCompte, double p_solde, double p_tauxInteret, 
+ *                                 const std::string& p_description, const util::Date& p_dateOuverture)
+ *        cas valide:
+ *          creerValide: le compte fabriqué a les attributs passés en paramètres
+ *        cas invalides:
+ *          creerInvalide: solde négatif, taux hors de [0.1, 3.5]; aucune exception
+ */
+TEST(Epargne, creerValide)
+{
+  std::optional<Epargne> compte = Epargne::creer(10, 100.0, 1.2, "Reer", util::Date(1, 2, 2020));
+  ASSERT_TRUE(compte.has_value());
+  ASSERT_EQ(10, compte->reqNoCompte());
+  ASSERT_EQ(util::Date(1, 2, 2020), compte->reqDateOuvertureRef());
+}
+TEST(Epargne, creerInvalide)
+{
+  ASSERT_FALSE(Epargne::creer(10, -1.0, 1.2).has_value());
+  ASSERT_FALSE(Epargne::creer(10, 100.0, 3.6).has_value());
+  ASSERT_FALSE(Epargne::creer(10, 100.0, 0.0).has_value());
+}
@@ -0,0 +1,160 @@
+/**
+ * \file ExportateurTesteur.cpp
+ * \brief Test unitaire de la classe Exportateur
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          Exportateur(int p_descripteur, FormatExport p_format, std::size_t p_capacite);
+ *          void exporterClient(const Client& p_client);
+ *          void exporterBanque(const Banque& p_banque);
+ *          void terminer();
+ *          std::uint64_t reqNbrLignes() const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "Banque.h"
+#include "Exportateur.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \class UnExport
+ * \brief création d'une fixture: un fichier temporaire et une banque de deux clients
+ */
+class UnExport: public::testing::Test
+{
+public:
+  UnExport () : t_fichier(tmpfile())
+  {
+    Client client(3333, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131");
+    client.ajouterCompte(Cheque(10, -12.5, 2.3, 5, 0.1, "Compte \"courant\", principal"));
+    client.ajouterCompte(Epargne(20, 100.25, 1.5, "Reer", util::Date(1, 2, 2020)));
+    t_banque.ajouterClient(client);
+    t_banque.ajouterClient(Client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999"));
+  }
+  ~UnExport ()
+  {
+    fclose(t_fichier);
+  }
+  string lireFichier ()
+  {
+    string contenu;
+    char morceau[256];
+    rewind(t_fichier);
+    for (size_t n; (n = fread(morceau, 1, sizeof(morceau), t_fichier)) > 0; )
+      {
+        contenu.append(morceau, n);
+      }
+    return contenu;
+  }
+  FILE* t_fichier;
+  Banque t_banque;
+};
+
+
+/**
+ * \brief Test de l'export CSV, JSON Lines et colonnes binaires
+ *        cas valides:
+ *          exportCsv: en-tête, une ligne par compte, client sans compte, champ entre guillemets
+ *          exportJsonLignes: un objet par client en ordre de folio, guillemets échappés
+ *          exportColonnes: en-tête, groupe de 3 lignes, colonnes typées et groupe terminal
+ *          petitTampon: même contenu avec un tampon de 64 octets
+ *        cas invalide:
+ *          exportTermine: exporter après terminer() est refusé
+ */
+TEST_F(UnExport, exportCsv)
+{
+  {
+    Exportateur exportateur(fileno(t_fichier), FormatExport::CSV);
+    exportateur.exporterBanque(t_banque);
+    ASSERT_EQ(exportateur.reqNbrLignes(), 3);
+  }
+  string attendu = "folio,nom,prenom,dateNaissance,telephone,type,noCompte,description,"
+                   "dateOuverture,tauxInteret,solde,nbrTransactions,tauxInteretMinimum\n"
+                   "1001,Doe,Jane,1972-07-02,3331119999,,,,,,,,\n"
+                   "3333,Dortelus,Judith,1988-09-07,4186562131,cheque,10,\"Compte \"\"courant\"\", principal\",";
+  string contenu = lireFichier();
+  ASSERT_EQ(contenu.compare(0, attendu.size(), attendu), 0);
+  ASSERT_NE(contenu.find(",2.3,-12.5,5,0.1\n"), string::npos);
+  ASSERT_NE(contenu.find("3333,Dortelus,Judith,1988-09-07,4186562131,epargne,20,Reer,2020-02-01,1.5,100.25,,\n"), string::npos);
+}
+TEST_F(UnExport, exportJsonLignes)
+{
+  Exportateur exportateur(fileno(t_fichier), FormatExport::JSON_LIGNES);
+  exportateur.exporterBanque(t_banque);
+  exportateur.terminer();
+  string contenu = lireFichier();
+  ASSERT_EQ(exportateur.reqNbrLignes(), 2);
+  ASSERT_EQ(contenu.find("{\"folio\":1001,\"nom\":\"Doe\",\"prenom\":\"Jane\",\"dateNaissance\":\"1972-07-02\","
+                         "\"telephone\":\"3331119999\",\"comptes\":[]}\n"), 0);
+  ASSERT_NE(contenu.find("\"description\":\"Compte \\\"courant\\\", principal\""), string::npos);
+  ASSERT_NE(contenu.find("{\"type\":\"epargne\",\"noCompte\":20,\"description\":\"Reer\",\"dateOuverture\":\"2020-02-01\","
+                         "\"tauxInteret\":1.5,\"solde\":100.25}]}\n"), string::npos);
+}
+TEST_F(UnExport, exportColonnes)
+{
+  Exportateur exportateur(fileno(t_fichier), FormatExport::COLONNES_BINAIRE);
+  exportateur.exporterBanque(t_banque);
+  exportateur.terminer();
+  string contenu = lireFichier();
+  ASSERT_EQ(contenu.compare(0, 8, "TP3COL01"), 0);
+
+  const char* position = contenu.data() + 8;
+  uint32_t nbrLignes;
+  memcpy(&nbrLignes, position, sizeof(nbrLignes));
+  ASSERT_EQ(nbrLignes, 3);
+  position += sizeof(uint32_t);
+  uint32_t folios[3];
+  memcpy(folios, position, sizeof(folios));
+  ASSERT_EQ(folios[0], 1001);
+  ASSERT_EQ(folios[2], 3333);
+  position += sizeof(folios);
+  ASSERT_EQ(position[0], 0);
+  ASSERT_EQ(position[1], 1);
+  ASSERT_EQ(position[2], 2);
+  position += 3 + 3 * sizeof(uint32_t);
+  double soldes[3];
+  memcpy(soldes, position, sizeof(soldes));
+  ASSERT_DOUBLE_EQ(soldes[1], -12.5);
+  ASSERT_DOUBLE_EQ(soldes[2], 100.25);
+  position += 2 * sizeof(soldes);
+  int32_t dates[3];
+  memcpy(dates, position, sizeof(dates));
+  ASSERT_EQ(dates[2], util::Date(1, 2, 2020) - util::Date(1, 1, 1970));
+
+  uint32_t fin;
+  memcpy(&fin, contenu.data() + contenu.size() - sizeof(fin), sizeof(fin));
+  ASSERT_EQ(fin, 0);
+}
+TEST_F(UnExport, petitTampon)
+{
+  FILE* autreFichier = tmpfile();
+  {
+    Exportateur petit(fileno(t_fichier), FormatExport::JSON_LIGNES, 1);
+    Exportateur grand(fileno(autreFichier), FormatExport::JSON_LIGNES);
+    petit.exporterBanque(t_banque);
+    grand.exporterBanque(t_banque);
+  }
+  string contenu = lireFichier();
+  fclose(t_fichier);
+  t_fichier = autreFichier;
+  ASSERT_EQ(contenu, lireFichier());
+}
+TEST_F(UnExport, exportTermine)
+{
+  Exportateur exportateur(fileno(t_fichier), FormatExport::CSV);
+  exportateur.terminer();
+  ASSERT_THROW(exportateur.exporterClient(t_banque.reqClient(1001)), PreconditionException);
+}
@@ -0,0 +1,74 @@
+/**
+ * \file FormateurReleveTesteur.cpp
+ * \brief Test unitaire de la classe FormateurReleve
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          std::string_view formaterCompte(const Compte& p_compte);
+ *          std::string_view formaterClient(const Client& p_client);
+ *          std::string_view formaterReleves(const Client& p_client);
+ *          static FormateurReleve& duFil();
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <string>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "FormateurReleve.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \class UnClientAvecComptes
+ * \brief création d'une fixture: un client avec des comptes aux valeurs d'arrondi délicates
+ */
+class UnClientAvecComptes: public::testing::Test
+{
+public:
+  UnClientAvecComptes () : t_client(3333, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131")
+  {
+    t_client.ajouterCompte(Cheque(10, -1234.5, 2.345, 5, 0.125, "Compte courant"));
+    t_client.ajouterCompte(Cheque(11, 100.5, 0.2, 30));
+    t_client.ajouterCompte(Epargne(20, 101.5, 3.5, "Reer", util::Date(1, 1, 2020)));
+    t_client.ajouterCompte(Epargne(21, 123456789.0, 0.1, "Celi", util::Date(31, 12, 2037)));
+  }
+  Client t_client;
+  FormateurReleve t_formateur;
+};
+
+
+/**
+ * \brief Test des méthodes formaterCompte, formaterClient et formaterReleves
+ *        cas valides:
+ *          compteIdentique: même texte que reqCompteFormate pour chaque compte
+ *          clientIdentique: même texte que reqClientFormate
+ *          relevesIdentiques: même texte que reqReleves, tampon agrandi au besoin
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnClientAvecComptes, compteIdentique)
+{
+  Cheque cheque(12, 0.0, 1.0, 0);
+  ASSERT_EQ(string(t_formateur.formaterCompte(cheque)), cheque.reqCompteFormate());
+  Epargne epargne(13, 0.0, 0.1);
+  ASSERT_EQ(string(t_formateur.formaterCompte(epargne)), epargne.reqCompteFormate());
+}
+TEST_F(UnClientAvecComptes, clientIdentique)
+{
+  ASSERT_EQ(string(t_formateur.formaterClient(t_client)), t_client.reqClientFormate());
+}
+TEST_F(UnClientAvecComptes, relevesIdentiques)
+{
+  ASSERT_EQ(string(t_formateur.formaterReleves(t_client)), t_client.reqReleves());
+  for (unsigned i = 100; i < 200; i++)
+    {
+      t_client.ajouterCompte(Cheque(i, i * 10.5, 1.5, i % 41, 0.5, "Compte " + to_string(i)));
+    }
+  ASSERT_EQ(string(FormateurReleve::duFil().formaterReleves(t_client)), t_client.reqReleves());
+}
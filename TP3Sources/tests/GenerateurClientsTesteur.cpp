@@ -0,0 +1,210 @@
+/**
+ * \file GenerateurClientsTesteur.cpp
+ * \brief Test unitaire de la classe GenerateurClients
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          GenerateurClients(const ParametresGeneration& p_parametres);
+ *          unsigned genererTexte(std::uint64_t p_rang, std::string& p_tampon) const;
+ *          Client genererClient(std::uint64_t p_rang) const;
+ *          std::uint64_t ecrireTexte(int p_descripteur, unsigned p_nbFils) const;
+ *          std::uint64_t ecrireColonnes(int p_descripteur) const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Cheque.h"
+#include "GenerateurClients.h"
+#include "LecteurClients.h"
+#include "validationFichier.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace bancaire;
+
+namespace
+{
+/**
+ * \brief Écrit le texte du générateur dans un fichier temporaire et en retourne le contenu
+ */
+string ecrireEtRelire (const GenerateurClients& p_generateur, unsigned p_nbFils, uint64_t& p_nbrComptes)
+{
+  string chemin = testing::TempDir() + "GenerateurClientsTesteur.txt";
+  int descripteur = ::open(chemin.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  p_nbrComptes = p_generateur.ecrireTexte(descripteur, p_nbFils);
+  ::close(descripteur);
+  ostringstream contenu;
+  contenu << ifstream(chemin, ios::binary).rdbuf();
+  remove(chemin.c_str());
+  return contenu.str();
+}
+}
+
+
+/**
+ * \class UnGenerateur
+ * \brief création d'une fixture: 40000 clients de 0 à 6 comptes, soit plus de deux lots
+ */
+class UnGenerateur: public::testing::Test
+{
+public:
+  UnGenerateur ()
+  {
+    t_parametres.m_graine = 42;
+    t_parametres.m_nbrClients = 40000;
+    t_parametres.m_nbrComptesMin = 0;
+    t_parametres.m_nbrComptesMax = 6;
+  }
+  ParametresGeneration t_parametres;
+};
+
+
+/**
+ * \brief Test de la génération en texte
+ *        cas valides:
+ *          texteValide: chaque client passe validerFormatFichier et validerEnregistrements
+ *          deterministe: même graine, même texte; autre graine, autre texte
+ *          independantDuNombreDeFils: même fichier avec 1 et 4 fils, relu entièrement par LecteurClients
+ *          distributions: bornes du nombre de comptes, soldes d'épargne positifs, paliers de transactions
+ *          folios: folios de 1000 à 9999 pour les rangs 0 à 8999, répétés à partir du rang 9000
+ *        cas invalides:
+ *          parametresInvalides: bornes inversées, proportion ou taux hors limites, poids nuls
+ */
+TEST_F(UnGenerateur, texteValide)
+{
+  GenerateurClients generateur(t_parametres);
+  string tout;
+  for (uint64_t rang = 0; rang < 200; rang++)
+    {
+      string client;
+      generateur.genererTexte(rang, client);
+      istringstream entree(rang == 0 ? client : client.substr(1));
+      ASSERT_TRUE(util::validerFormatFichier(entree)) << client;
+      tout += client;
+    }
+  ASSERT_TRUE(util::validerEnregistrements(tout).empty());
+}
+TEST_F(UnGenerateur, deterministe)
+{
+  string premier;
+  string second;
+  GenerateurClients(t_parametres).genererTexte(17, premier);
+  GenerateurClients(t_parametres).genererTexte(17, second);
+  ASSERT_EQ(premier, second);
+  t_parametres.m_graine = 43;
+  second.clear();
+  GenerateurClients(t_parametres).genererTexte(17, second);
+  ASSERT_NE(premier, second);
+}
+TEST_F(UnGenerateur, independantDuNombreDeFils)
+{
+  GenerateurClients generateur(t_parametres);
+  uint64_t nbrComptesSeq;
+  uint64_t nbrComptesPar;
+  string sequentiel = ecrireEtRelire(generateur, 1, nbrComptesSeq);
+  string parallele = ecrireEtRelire(generateur, 4, nbrComptesPar);
+  ASSERT_EQ(nbrComptesSeq, nbrComptesPar);
+  ASSERT_TRUE(sequentiel == parallele);
+
+  LecteurClients lecteur(sequentiel);
+  uint64_t nbrClients = 0;
+  uint64_t nbrComptes = 0;
+  while (optional<Client> client = lecteur.lireClient())
+    {
+      nbrClients++;
+      while (lecteur.lireCompte())
+        {
+          nbrComptes++;
+        }
+    }
+  ASSERT_EQ(nbrClients, t_parametres.m_nbrClients);
+  ASSERT_EQ(nbrComptes, nbrComptesSeq);
+  ASSERT_EQ(lecteur.reqNbrRejets(), 0);
+}
+TEST_F(UnGenerateur, distributions)
+{
+  t_parametres.m_distributionComptes = DistributionComptes::GEOMETRIQUE;
+  t_parametres.m_nbrComptesMin = 1;
+  t_parametres.m_nbrComptesMax = 50;
+  t_parametres.m_nbrComptesMoyen = 3.0;
+  t_parametres.m_proportionCheques = 1.0;
+  t_parametres.m_poidsPaliers[0] = 0.0;
+  t_parametres.m_poidsPaliers[3] = 0.0;
+  GenerateurClients generateur(t_parametres);
+
+  uint64_t nbrComptes = 0;
+  const uint64_t nbrClients = 5000;
+  for (uint64_t rang = 0; rang < nbrClients; rang++)
+    {
+      Client client = generateur.genererClient(rang);
+      ASSERT_GE(client.reqNbrComptes(), 1);
+      ASSERT_LE(client.reqNbrComptes(), 50);
+      nbrComptes += client.reqNbrComptes();
+      for (size_t i = 0; i < client.reqNbrComptes(); i++)
+        {
+          const Cheque& cheque = dynamic_cast<const Cheque&>(client.reqCompte(i));
+          ASSERT_GE(cheque.reqNbrTransactions(), 11);
+          ASSERT_LE(cheque.reqNbrTransactions(), 35);
+        }
+    }
+  const double moyenne = static_cast<double>(nbrComptes) / nbrClients;
+  ASSERT_NEAR(moyenne, 3.0, 0.15);
+}
+TEST_F(UnGenerateur, folios)
+{
+  GenerateurClients generateur(t_parametres);
+  ASSERT_EQ(generateur.genererClient(0).reqNoFolio(), 1000);
+  ASSERT_EQ(generateur.genererClient(8999).reqNoFolio(), 9999);
+  ASSERT_EQ(generateur.genererClient(9000).reqNoFolio(), generateur.genererClient(0).reqNoFolio());
+  ASSERT_EQ(generateur.genererClient(9123).reqNoFolio(), generateur.genererClient(123).reqNoFolio());
+}
+TEST(GenerateurClients, parametresInvalides)
+{
+  ParametresGeneration parametres;
+  parametres.m_nbrComptesMin = 5;
+  parametres.m_nbrComptesMax = 4;
+  ASSERT_THROW(GenerateurClients generateur(parametres), PreconditionException);
+  parametres = ParametresGeneration();
+  parametres.m_proportionCheques = 1.5;
+  ASSERT_THROW(GenerateurClients generateur(parametres), PreconditionException);
+  parametres = ParametresGeneration();
+  parametres.m_tauxEpargneMax = 4.0;
+  ASSERT_THROW(GenerateurClients generateur(parametres), PreconditionException);
+  parametres = ParametresGeneration();
+  fill(begin(parametres.m_poidsPaliers), end(parametres.m_poidsPaliers), 0.0);
+  ASSERT_THROW(GenerateurClients generateur(parametres), PreconditionException);
+}
+
+
+/**
+ * \brief Test de la génération en colonnes binaires
+ *        cas valide:
+ *          colonnesBinaires: en-tête du format et même nombre de comptes que le texte
+ */
+TEST_F(UnGenerateur, colonnesBinaires)
+{
+  t_parametres.m_nbrClients = 300;
+  t_parametres.m_nbrComptesMin = 1;
+  GenerateurClients generateur(t_parametres);
+  uint64_t nbrComptesTexte;
+  ecrireEtRelire(generateur, 2, nbrComptesTexte);
+
+  string chemin = testing::TempDir() + "GenerateurClientsTesteur.bin";
+  int descripteur = ::open(chemin.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  ASSERT_EQ(generateur.ecrireColonnes(descripteur), nbrComptesTexte);
+  ::close(descripteur);
+  ostringstream contenu;
+  contenu << ifstream(chemin, ios::binary).rdbuf();
+  remove(chemin.c_str());
+  ASSERT_EQ(contenu.str().substr(0, 8), "TP3COL01");
+}
@@ -0,0 +1,70 @@
+/**
+ * \file GroupeFilsTesteur.cpp
+ * \brief Test unitaire de la classe GroupeFils
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          template <typename Tache> void GroupeFils::lancer(Tache p_tache);
+ *          void GroupeFils::joindre();
+ *          GroupeFils::~GroupeFils();
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "GroupeFils.h"
+
+using namespace std;
+using namespace util;
+
+
+/**
+ * \brief Test du lancement et de la jointure des fils
+ *        cas valide:
+ *          tousJoints: après joindre(), chaque tâche lancée a été exécutée
+ *        cas invalides:
+ *          exceptionDuFil: l'exception d'une tâche est relancée par joindre(), une seule fois
+ *          exceptionDuFilAppelant: une exception du fil appelant détruit le groupe
+ *                                  sans std::terminate, après la fin des fils lancés
+ */
+TEST(GroupeFils, tousJoints)
+{
+  atomic<int> nbTaches(0);
+  GroupeFils fils;
+  for (int i = 0; i < 8; i++)
+    {
+      fils.lancer([&nbTaches] { nbTaches++; });
+    }
+  fils.joindre();
+  ASSERT_EQ(nbTaches, 8);
+}
+TEST(GroupeFils, exceptionDuFil)
+{
+  atomic<int> nbTaches(0);
+  GroupeFils fils;
+  fils.lancer([] { throw runtime_error("tache"); });
+  fils.lancer([&nbTaches] { nbTaches++; });
+  ASSERT_THROW(fils.joindre(), runtime_error);
+  ASSERT_EQ(nbTaches, 1);
+  ASSERT_NO_THROW(fils.joindre());
+}
+TEST(GroupeFils, exceptionDuFilAppelant)
+{
+  atomic<int> nbTaches(0);
+  try
+    {
+      GroupeFils fils;
+      for (int i = 0; i < 4; i++)
+        {
+          fils.lancer([&nbTaches] { nbTaches++; });
+        }
+      throw runtime_error("appelant");
+    }
+  catch (const runtime_error&)
+    {
+    }
+  ASSERT_EQ(nbTaches, 4);
+}
@@ -0,0 +1,212 @@
+/**
+ * \file IndexComptesTesteur.cpp
+ * \brief Test unitaire de la classe IndexComptes
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          IndexComptes(const Client& p_client);
+ *          std::size_t reqNbrComptes() const;
+ *          void ajouter(const Compte& p_compte);
+ *          void ajouterComptes(const std::vector<std::unique_ptr<Compte>>& p_comptes);
+ *          void retirer(std::uint32_t p_rang);
+ *          std::optional<std::uint32_t> chercherNumero(unsigned p_noCompte) const;
+ *          std::vector<std::uint32_t> rechercher(const CritereRecherche& p_critere) const;
+ *          static std::string normaliserDescription(std::string_view p_description);
+ *          bool CritereRecherche::estVide() const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "IndexComptes.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \class UnClientIndexe
+ * \brief création d'une fixture: un client de six comptes et son index
+ */
+class UnClientIndexe: public::testing::Test
+{
+public:
+  UnClientIndexe () : t_client(3333, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131")
+  {
+    t_client.ajouterCompte(Cheque(12, 100.0, 0.5, 3, 0.1, "Courant"));
+    t_client.ajouterCompte(Epargne(120, 2500.0, 1.5, "Reer"));
+    t_client.ajouterCompte(Cheque(1299, 50.0, 0.5, 3, 0.1, "courant voyage"));
+    t_client.ajouterCompte(Epargne(21, 800.0, 1.5, "Celi"));
+    t_client.ajouterCompte(Cheque(13, 1000.0, 0.5, 3, 0.1, "Cour"));
+    t_client.ajouterCompte(Epargne(91200, 100.0, 1.5, "Reee"));
+  }
+  Client t_client;
+};
+
+
+/**
+ * \brief Test de la recherche des comptes
+ *        cas valides:
+ *          aucunCritere: tous les rangs, index d'un client sans compte
+ *          prefixeNumero: 12 retient 12, 120 et 1299 mais pas 91200
+ *          prefixeDescription: sans égard à la casse
+ *          plageSolde: bornes incluses, bornes ouvertes d'un côté
+ *          criteresCombines: intersection des critères, rangs en ordre croissant
+ *        cas invalides:
+ *          prefixeNumeroInvalide: chiffres absents, zéro initial ou trop de chiffres
+ *          soldeInverse: solde minimum plus grand que le maximum
+ */
+TEST_F(UnClientIndexe, aucunCritere)
+{
+  IndexComptes index(t_client);
+  ASSERT_EQ(index.reqNbrComptes(), 6);
+  ASSERT_TRUE(CritereRecherche().estVide());
+  ASSERT_EQ(index.rechercher(CritereRecherche()), (vector<uint32_t>{0, 1, 2, 3, 4, 5}));
+
+  Client vide(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999");
+  ASSERT_TRUE(IndexComptes(vide).rechercher(CritereRecherche()).empty());
+}
+TEST_F(UnClientIndexe, prefixeNumero)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_prefixeNumero = "12";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 1, 2}));
+  critere.m_prefixeNumero = "9";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{5}));
+  critere.m_prefixeNumero = "1";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 1, 2, 4}));
+}
+TEST_F(UnClientIndexe, prefixeDescription)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_prefixeDescription = "COUR";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 2, 4}));
+  critere.m_prefixeDescription = "courant ";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{2}));
+  critere.m_prefixeDescription = "x";
+  ASSERT_TRUE(index.rechercher(critere).empty());
+  ASSERT_EQ(IndexComptes::normaliserDescription("Épargne REER"), "Épargne reer");
+}
+TEST_F(UnClientIndexe, plageSolde)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_soldeMin = 100.0;
+  critere.m_soldeMax = 1000.0;
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 3, 4, 5}));
+  critere.m_soldeMin.reset();
+  critere.m_soldeMax = 99.0;
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{2}));
+  critere.m_soldeMin = 2000.0;
+  critere.m_soldeMax.reset();
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{1}));
+}
+TEST_F(UnClientIndexe, criteresCombines)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_prefixeNumero = "1";
+  critere.m_prefixeDescription = "cour";
+  critere.m_soldeMin = 60.0;
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 4}));
+}
+TEST_F(UnClientIndexe, prefixeNumeroInvalide)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_prefixeNumero = "1a";
+  ASSERT_TRUE(index.rechercher(critere).empty());
+  critere.m_prefixeNumero = "012";
+  ASSERT_TRUE(index.rechercher(critere).empty());
+  critere.m_prefixeNumero = "12345678901";
+  ASSERT_TRUE(index.rechercher(critere).empty());
+}
+TEST_F(UnClientIndexe, soldeInverse)
+{
+  IndexComptes index(t_client);
+  CritereRecherche critere;
+  critere.m_soldeMin = 1000.0;
+  critere.m_soldeMax = 100.0;
+  ASSERT_TRUE(index.rechercher(critere).empty());
+}
+
+
+/**
+ * \brief Test de la mise à jour de l'index
+ *        cas valides:
+ *          ajouterRetirer: mêmes résultats qu'un index reconstruit après les mêmes opérations
+ *          ajouterComptes: un lot fusionné donne les mêmes résultats qu'un index reconstruit
+ *          chercherNumero: rang d'un compte présent
+ *        cas invalides:
+ *          retirerRangInvalide: rang hors de l'index
+ *          chercherNumeroAbsent: std::nullopt pour un numéro absent
+ */
+TEST_F(UnClientIndexe, ajouterRetirer)
+{
+  IndexComptes index(t_client);
+  Cheque nouveau(125, 300.0, 0.5, 3, 0.1, "Courant");
+  t_client.ajouterCompte(nouveau);
+  index.ajouter(nouveau);
+  t_client.supprimerCompte(120);
+  index.retirer(1);
+
+  IndexComptes reconstruit(t_client);
+  CritereRecherche critere;
+  critere.m_prefixeNumero = "12";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 1, 5}));
+  ASSERT_EQ(index.rechercher(critere), reconstruit.rechercher(critere));
+  critere.m_prefixeNumero.clear();
+  critere.m_prefixeDescription = "cour";
+  critere.m_soldeMin = 200.0;
+  ASSERT_EQ(index.rechercher(critere), reconstruit.rechercher(critere));
+  ASSERT_EQ(index.reqNbrComptes(), 6);
+}
+TEST_F(UnClientIndexe, ajouterComptes)
+{
+  IndexComptes index(t_client);
+  vector<unique_ptr<Compte>> lot;
+  lot.push_back(make_unique<Cheque>(1250, 10.0, 0.5, 3, 0.1, "Courant lot"));
+  lot.push_back(make_unique<Epargne>(7, 5000.0, 1.5, "Celi lot"));
+  lot.push_back(make_unique<Epargne>(122, 100.0, 1.5, "Reer lot"));
+  index.ajouterComptes(lot);
+  t_client.essayerAjouterComptes(std::move(lot));
+
+  IndexComptes reconstruit(t_client);
+  ASSERT_EQ(index.reqNbrComptes(), 9);
+  CritereRecherche critere;
+  critere.m_prefixeNumero = "12";
+  ASSERT_EQ(index.rechercher(critere), (vector<uint32_t>{0, 1, 2, 6, 8}));
+  critere.m_prefixeNumero.clear();
+  critere.m_prefixeDescription = "c";
+  critere.m_soldeMax = 800.0;
+  ASSERT_EQ(index.rechercher(critere), reconstruit.rechercher(critere));
+  ASSERT_EQ(index.chercherNumero(7), reconstruit.chercherNumero(7));
+}
+TEST_F(UnClientIndexe, retirerRangInvalide)
+{
+  IndexComptes index(t_client);
+  ASSERT_THROW(index.retirer(6), PreconditionException);
+}
+TEST_F(UnClientIndexe, chercherNumero)
+{
+  IndexComptes index(t_client);
+  ASSERT_EQ(index.chercherNumero(12), 0u);
+  ASSERT_EQ(index.chercherNumero(91200), 5u);
+  index.retirer(0);
+  ASSERT_EQ(index.chercherNumero(91200), 4u);
+}
+TEST_F(UnClientIndexe, chercherNumeroAbsent)
+{
+  IndexComptes index(t_client);
+  ASSERT_FALSE(index.chercherNumero(11).has_value());
+  ASSERT_FALSE(index.chercherNumero(100000).has_value());
+}
@@ -0,0 +1,212 @@
+/**
+ * \file InstrumentationTesteur.cpp
+ * \brief Test unitaire des classes HistogrammeLatence et Instrumentation
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          void HistogrammeLatence::enregistrer(std::uint64_t p_nanosecondes);
+ *          void HistogrammeLatence::fusionner(const HistogrammeLatence& p_autre);
+ *          std::uint64_t HistogrammeLatence::reqPercentile(double p_percentile) const;
+ *          static unsigned HistogrammeLatence::caseDe(std::uint64_t p_valeur);
+ *          static void Instrumentation::enregistrer(PointMesure p_point, std::uint64_t p_nanosecondes);
+ *          static HistogrammeLatence Instrumentation::reqHistogramme(PointMesure p_point);
+ *          static std::string Instrumentation::rapport();
+ *          static void Instrumentation::reinitialiser();
+ *          MESURER_LATENCE(point)
+ */
+#define INSTRUMENTATION
+
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "Instrumentation.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace util;
+
+
+/**
+ * \brief Test des cases de l'histogramme
+ *        cas valides:
+ *          casesContigues: chaque valeur tombe entre les bornes de sa case, les cases se suivent sans trou
+ *          precisionRelative: la largeur d'une case ne dépasse pas 1/32 de sa borne inférieure
+ *        cas invalide:
+ *          caseInvalide: numéro de case hors limites
+ */
+TEST(HistogrammeLatence, casesContigues)
+{
+  ASSERT_EQ(HistogrammeLatence::borneInferieure(0), 0);
+  for (unsigned i = 0; i + 1 < HistogrammeLatence::NB_CASES; i++)
+    {
+      ASSERT_EQ(HistogrammeLatence::borneSuperieure(i) + 1, HistogrammeLatence::borneInferieure(i + 1)) << i;
+      ASSERT_EQ(HistogrammeLatence::caseDe(HistogrammeLatence::borneInferieure(i)), i);
+      ASSERT_EQ(HistogrammeLatence::caseDe(HistogrammeLatence::borneSuperieure(i)), i);
+    }
+  ASSERT_EQ(HistogrammeLatence::caseDe(numeric_limits<uint64_t>::max()), HistogrammeLatence::NB_CASES - 1);
+}
+TEST(HistogrammeLatence, precisionRelative)
+{
+  for (unsigned i = 2 * HistogrammeLatence::NB_SOUS_CASES; i + 1 < HistogrammeLatence::NB_CASES; i++)
+    {
+      const uint64_t largeur = HistogrammeLatence::borneSuperieure(i) - HistogrammeLatence::borneInferieure(i) + 1;
+      ASSERT_LE(largeur * HistogrammeLatence::NB_SOUS_CASES, HistogrammeLatence::borneInferieure(i)) << i;
+    }
+}
+TEST(HistogrammeLatence, caseInvalide)
+{
+  ASSERT_THROW(HistogrammeLatence::borneInferieure(HistogrammeLatence::NB_CASES), PreconditionException);
+}
+
+
+/**
+ * \brief Test des statistiques de l'histogramme
+ *        cas valides:
+ *          vide: toutes les statistiques valent 0
+ *          percentiles: valeurs de 1 à 100000, percentiles à 1/32 près, min, max et moyenne exacts
+ *          fusionner: la fusion de deux histogrammes équivaut à un seul histogramme
+ *        cas invalide:
+ *          percentileInvalide: pourcentage négatif ou supérieur à 100
+ */
+TEST(HistogrammeLatence, vide)
+{
+  HistogrammeLatence histogramme;
+  ASSERT_EQ(histogramme.reqNbValeurs(), 0);
+  ASSERT_EQ(histogramme.reqMin(), 0);
+  ASSERT_EQ(histogramme.reqMax(), 0);
+  ASSERT_EQ(histogramme.reqMoyenne(), 0.0);
+  ASSERT_EQ(histogramme.reqPercentile(50.0), 0);
+}
+TEST(HistogrammeLatence, percentiles)
+{
+  HistogrammeLatence histogramme;
+  for (uint64_t valeur = 1; valeur <= 100000; valeur++)
+    {
+      histogramme.enregistrer(valeur);
+    }
+  ASSERT_EQ(histogramme.reqNbValeurs(), 100000);
+  ASSERT_EQ(histogramme.reqMin(), 1);
+  ASSERT_EQ(histogramme.reqMax(), 100000);
+  ASSERT_DOUBLE_EQ(histogramme.reqMoyenne(), 50000.5);
+  for (double percentile : {1.0, 50.0, 90.0, 99.0, 99.9})
+    {
+      const double attendu = percentile * 1000.0;
+      const double obtenu = static_cast<double>(histogramme.reqPercentile(percentile));
+      ASSERT_GE(obtenu, attendu) << percentile;
+      ASSERT_LE(obtenu, attendu * (1.0 + 1.0 / HistogrammeLatence::NB_SOUS_CASES)) << percentile;
+    }
+  ASSERT_EQ(histogramme.reqPercentile(0.0), 1);
+  ASSERT_EQ(histogramme.reqPercentile(100.0), 100000);
+}
+TEST(HistogrammeLatence, fusionner)
+{
+  HistogrammeLatence pairs;
+  HistogrammeLatence impairs;
+  HistogrammeLatence tous;
+  for (uint64_t valeur = 0; valeur < 5000; valeur++)
+    {
+      (valeur % 2 == 0 ? pairs : impairs).enregistrer(valeur * 37);
+      tous.enregistrer(valeur * 37);
+    }
+  pairs.fusionner(impairs);
+  ASSERT_EQ(pairs.reqNbValeurs(), tous.reqNbValeurs());
+  ASSERT_EQ(pairs.reqMin(), tous.reqMin());
+  ASSERT_EQ(pairs.reqMax(), tous.reqMax());
+  ASSERT_EQ(pairs.reqMoyenne(), tous.reqMoyenne());
+  for (unsigned i = 0; i < HistogrammeLatence::NB_CASES; i++)
+    {
+      ASSERT_EQ(pairs.reqNbValeursCase(i), tous.reqNbValeursCase(i));
+    }
+}
+TEST(HistogrammeLatence, percentileInvalide)
+{
+  HistogrammeLatence histogramme;
+  ASSERT_THROW(histogramme.reqPercentile(-1.0), PreconditionException);
+  ASSERT_THROW(histogramme.reqPercentile(100.5), PreconditionException);
+}
+
+
+/**
+ * \class UneInstrumentation
+ * \brief création d'une fixture: les mesures sont remises à zéro avant chaque test
+ */
+class UneInstrumentation: public::testing::Test
+{
+public:
+  UneInstrumentation ()
+  {
+    Instrumentation::reinitialiser();
+  }
+};
+
+
+/**
+ * \brief Test de l'agrégation des mesures
+ *        cas valides:
+ *          plusieursFils: les mesures des fils terminés et du fil courant sont toutes fusionnées
+ *          mesurerLatence: la macro enregistre une mesure à la fin du bloc
+ *          rapport: en-tête, une ligne par point mesuré seulement
+ *          reinitialiser: plus aucune mesure, y compris celles des fils terminés
+ */
+TEST_F(UneInstrumentation, plusieursFils)
+{
+  const unsigned nbFils = 4;
+  const uint64_t nbMesures = 10000;
+  vector<thread> fils;
+  for (unsigned f = 0; f < nbFils; f++)
+    {
+      fils.emplace_back([f]
+        {
+          for (uint64_t i = 0; i < nbMesures; i++)
+            {
+              Instrumentation::enregistrer(PointMesure::AJOUTER_COMPTE, 100 * (f + 1));
+            }
+        });
+    }
+  for (thread& unFil : fils)
+    {
+      unFil.join();
+    }
+  Instrumentation::enregistrer(PointMesure::AJOUTER_COMPTE, 1);
+
+  HistogrammeLatence histogramme = Instrumentation::reqHistogramme(PointMesure::AJOUTER_COMPTE);
+  ASSERT_EQ(histogramme.reqNbValeurs(), nbFils * nbMesures + 1);
+  ASSERT_EQ(histogramme.reqMin(), 1);
+  ASSERT_EQ(histogramme.reqMax(), 400);
+  ASSERT_EQ(Instrumentation::reqNbAppels(PointMesure::SUPPRIMER_COMPTE), 0);
+}
+TEST_F(UneInstrumentation, mesurerLatence)
+{
+  for (int i = 0; i < 3; i++)
+    {
+      MESURER_LATENCE(REQ_RELEVES);
+      this_thread::sleep_for(chrono::microseconds(200));
+    }
+  HistogrammeLatence histogramme = Instrumentation::reqHistogramme(PointMesure::REQ_RELEVES);
+  ASSERT_EQ(histogramme.reqNbValeurs(), 3);
+  ASSERT_GE(histogramme.reqMin(), 200000);
+}
+TEST_F(UneInstrumentation, rapport)
+{
+  Instrumentation::enregistrer(PointMesure::CALCULER_INTERET, 1500);
+  const string rapport = Instrumentation::rapport();
+  ASSERT_NE(rapport.find("p99.9"), string::npos);
+  ASSERT_NE(rapport.find(Instrumentation::reqNomPoint(PointMesure::CALCULER_INTERET)), string::npos);
+  ASSERT_EQ(rapport.find(Instrumentation::reqNomPoint(PointMesure::REQ_RELEVES)), string::npos);
+  ASSERT_EQ(count(rapport.begin(), rapport.end(), '\n'), 2);
+}
+TEST_F(UneInstrumentation, reinitialiser)
+{
+  thread([] { Instrumentation::enregistrer(PointMesure::VALIDATION_FICHIER, 10); }).join();
+  Instrumentation::enregistrer(PointMesure::VALIDATION_FICHIER, 10);
+  ASSERT_EQ(Instrumentation::reqNbAppels(PointMesure::VALIDATION_FICHIER), 2);
+  Instrumentation::reinitialiser();
+  ASSERT_EQ(Instrumentation::reqNbAppels(PointMesure::VALIDATION_FICHIER), 0);
+  ASSERT_EQ(Instrumentation::reqHistogramme(PointMesure::VALIDATION_FICHIER).reqMin(), 0);
+}
@@ -0,0 +1,139 @@
+/**
+ * \file LecteurClientsTesteur.cpp
+ * \brief Test unitaire de la classe LecteurClients
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          LecteurClients(std::string_view p_contenu);
+ *          std::optional<Client> lireClient();
+ *          std::unique_ptr<Compte> lireCompte();
+ *          bool estTermine() const;
+ *          std::size_t reqPosition() const;
+ *          std::size_t reqTaille() const;
+ *          std::uint64_t reqNbrRejets() const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <string>
+
+#include "Client.h"
+#include "LecteurClients.h"
+
+using namespace std;
+using namespace bancaire;
+
+namespace
+{
+const string CLIENT_VALIDE =
+  "Dortelus\nJudith\n07 09 1988\n418 656-2131\n3333\n"
+  "cheque\n20\n2.3\n100.50\nCompte courant\n3\n0.1\n"
+  "epargne\n21\n1.5\n2000\nReer\n0\n01 01 2020\n";
+}
+
+
+/**
+ * \class UnContenuMultiClients
+ * \brief création d'une fixture: un client valide, un client au folio invalide,
+ *        puis un client dont le premier compte a un solde invalide
+ */
+class UnContenuMultiClients: public::testing::Test
+{
+public:
+  UnContenuMultiClients ()
+  {
+    t_contenu = CLIENT_VALIDE + "\n"
+      + "Tremblay\nMarc\n01 02 1970\n418 555-0000\n999\ncheque\n1\n1\n1\nx\n1\n1\n\n"
+      + "Roy\nAnne\n15 06 1999\n514 555-1234\n4444\n"
+      + "epargne\n7\n1\nabc\nReer\n0\n01 01 2020\n"
+      + "cheque\n8\n1\n10\nCourant\n1\n0.1\n";
+  }
+  string t_contenu;
+};
+
+
+/**
+ * \brief Test de la lecture des clients et des comptes
+ *        cas valides:
+ *          clientEtComptes: attributs du client et des comptes lus
+ *          comptesNonLusIgnores: lireClient passe au client suivant sans lire les comptes
+ *          contenuVide: aucun client, lecture terminée
+ *        cas invalides:
+ *          rejetsComptes: en-tête et compte invalides ignorés et comptés
+ *          dernierCompteRejete: le client suivant est lu malgré le rejet du dernier compte
+ */
+TEST(LecteurClients, clientEtComptes)
+{
+  LecteurClients lecteur(CLIENT_VALIDE);
+  ASSERT_EQ(lecteur.reqTaille(), CLIENT_VALIDE.size());
+
+  std::optional<Client> client = lecteur.lireClient();
+  ASSERT_TRUE(client.has_value());
+  ASSERT_EQ(client->reqNoFolio(), 3333);
+  ASSERT_EQ(client->reqNom(), "Dortelus");
+  ASSERT_EQ(client->reqNoTelephone(), 4186562131ULL);
+  ASSERT_EQ(client->reqDateNaissanceRef(), util::Date(7, 9, 1988));
+
+  unique_ptr<Compte> cheque = lecteur.lireCompte();
+  ASSERT_NE(dynamic_cast<Cheque*>(cheque.get()), nullptr);
+  ASSERT_EQ(cheque->reqNoCompte(), 20);
+  ASSERT_EQ(cheque->reqDescription(), "Compte courant");
+  ASSERT_EQ(static_cast<Cheque&>(*cheque).reqNbrTransactions(), 3);
+
+  unique_ptr<Compte> epargne = lecteur.lireCompte();
+  ASSERT_NE(dynamic_cast<Epargne*>(epargne.get()), nullptr);
+  ASSERT_EQ(epargne->reqSolde(), 2000);
+  ASSERT_EQ(epargne->reqDateOuvertureRef(), util::Date(1, 1, 2020));
+
+  ASSERT_EQ(lecteur.lireCompte(), nullptr);
+  ASSERT_FALSE(lecteur.lireClient().has_value());
+  ASSERT_TRUE(lecteur.estTermine());
+  ASSERT_EQ(lecteur.reqPosition(), CLIENT_VALIDE.size());
+  ASSERT_EQ(lecteur.reqNbrRejets(), 0);
+}
+TEST_F(UnContenuMultiClients, comptesNonLusIgnores)
+{
+  LecteurClients lecteur(t_contenu);
+  ASSERT_EQ(lecteur.lireClient()->reqNoFolio(), 3333);
+  ASSERT_EQ(lecteur.lireClient()->reqNoFolio(), 4444);
+  ASSERT_FALSE(lecteur.lireClient().has_value());
+  ASSERT_EQ(lecteur.reqNbrRejets(), 1);
+}
+TEST(LecteurClients, contenuVide)
+{
+  LecteurClients lecteur("\n\n");
+  ASSERT_FALSE(lecteur.lireClient().has_value());
+  ASSERT_EQ(lecteur.lireCompte(), nullptr);
+  ASSERT_TRUE(lecteur.estTermine());
+}
+TEST_F(UnContenuMultiClients, rejetsComptes)
+{
+  LecteurClients lecteur(t_contenu);
+  lecteur.lireClient();
+  while (lecteur.lireCompte())
+    {
+    }
+  std::optional<Client> client = lecteur.lireClient();
+  ASSERT_EQ(client->reqNoFolio(), 4444);
+  ASSERT_EQ(lecteur.reqNbrRejets(), 1);
+
+  unique_ptr<Compte> compte = lecteur.lireCompte();
+  ASSERT_EQ(compte->reqNoCompte(), 8);
+  ASSERT_EQ(lecteur.lireCompte(), nullptr);
+  ASSERT_EQ(lecteur.reqNbrRejets(), 2);
+}
+TEST(LecteurClients, dernierCompteRejete)
+{
+  const string contenu = CLIENT_VALIDE + "cheque\n22\n0.1\n10\nCourant\n1\n0.5\n\n"
+    + "Roy\nAnne\n15 06 1999\n514 555-1234\n4444\n";
+  LecteurClients lecteur(contenu);
+  lecteur.lireClient();
+  while (lecteur.lireCompte())
+    {
+    }
+  ASSERT_EQ(lecteur.reqNbrRejets(), 1);
+  std::optional<Client> client = lecteur.lireClient();
+  ASSERT_TRUE(client.has_value());
+  ASSERT_EQ(client->reqNoFolio(), 4444);
+}
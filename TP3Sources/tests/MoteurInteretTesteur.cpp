@@ -0,0 +1,132 @@
+/**
+ * \file MoteurInteretTesteur.cpp
+ * \brief Test unitaire de la classe MoteurInteret
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          int joursSelonConvention(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention);
+ *          MoteurInteret(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention);
+ *          void ajouterCompte(const Epargne& p_compte);
+ *          void calculer();
+ *          double reqInteret(size_t p_rang) const;
+ *          double reqTotal() const;
+ *          void Client::accumulerInterets (MoteurInteret& p_moteur) const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "Date.h"
+#include "Epargne.h"
+#include "Cheque.h"
+#include "Client.h"
+#include "MoteurInteret.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \brief Test de la fonction int joursSelonConvention(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention)
+ *        cas valides:
+ *          joursActuels: ACT/365 et ACT/360 comptent les jours réels, février bissextile compris
+ *          joursTrente360: mois de 30 jours, le 31 ramené au 30
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST(MoteurInteret, joursActuels)
+{
+  ASSERT_EQ(joursSelonConvention(util::Date(31, 1, 2024), util::Date(31, 3, 2024), ConventionJours::ACT_365), 60);
+  ASSERT_EQ(joursSelonConvention(util::Date(31, 1, 2024), util::Date(31, 3, 2024), ConventionJours::ACT_360), 60);
+}
+TEST(MoteurInteret, joursTrente360)
+{
+  ASSERT_EQ(joursSelonConvention(util::Date(31, 1, 2024), util::Date(31, 3, 2024), ConventionJours::TRENTE_360), 60);
+  ASSERT_EQ(joursSelonConvention(util::Date(15, 2, 2024), util::Date(15, 8, 2024), ConventionJours::TRENTE_360), 180);
+  ASSERT_EQ(joursSelonConvention(util::Date(1, 1, 2024), util::Date(1, 1, 2025), ConventionJours::TRENTE_360), 360);
+}
+
+
+/**
+ * \brief Test du constructeur MoteurInteret(const util::Date& p_debut, const util::Date& p_fin, ConventionJours p_convention)
+ *        cas valide:
+ *          aucun d'identifié
+ *        cas invalide:
+ *          periodeInvalide: la date de début est après la date de fin
+ */
+TEST(MoteurInteret, constructeur_periodeInvalide)
+{
+  ASSERT_THROW(MoteurInteret moteur(util::Date(2, 1, 2024), util::Date(1, 1, 2024), ConventionJours::ACT_365),
+               PreconditionException);
+}
+
+
+/**
+ * \class UnMoteurInteret
+ * \brief création d'une fixture pour des tests de la classe MoteurInteret sur l'année 2023
+ */
+class UnMoteurInteret: public::testing::Test
+{
+public:
+  UnMoteurInteret():
+    t_moteur(util::Date(31, 12, 2022), util::Date(31, 12, 2023), ConventionJours::ACT_365)
+    {
+
+    }
+  MoteurInteret t_moteur;
+};
+
+
+/**
+ * \brief Test des méthodes void ajouterCompte(const Epargne& p_compte) et void calculer()
+ *        cas valides:
+ *          anneeComplete: un compte ouvert avant la période court toute l'année
+ *          ouvertureDansPeriode: un compte court à partir de sa date d'ouverture
+ *          ouvertureApresPeriode: un compte ouvert après la période ne court pas
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnMoteurInteret, anneeComplete)
+{
+  t_moteur.ajouterCompte(Epargne(1, 1000, 2.0, "Epargne", util::Date(1, 6, 2020)));
+  t_moteur.calculer();
+
+  ASSERT_EQ(t_moteur.reqNbrComptes(), 1);
+  ASSERT_DOUBLE_EQ(t_moteur.reqInteret(0), 20.0);
+}
+TEST_F(UnMoteurInteret, ouvertureDansPeriode)
+{
+  t_moteur.ajouterCompte(Epargne(1, 3650, 1.0, "Epargne", util::Date(21, 12, 2023)));
+  t_moteur.calculer();
+
+  ASSERT_DOUBLE_EQ(t_moteur.reqInteret(0), 1.0);
+}
+TEST_F(UnMoteurInteret, ouvertureApresPeriode)
+{
+  t_moteur.ajouterCompte(Epargne(1, 3650, 1.0, "Epargne", util::Date(2, 1, 2024)));
+  t_moteur.calculer();
+
+  ASSERT_DOUBLE_EQ(t_moteur.reqInteret(0), 0.0);
+}
+
+
+/**
+ * \brief Test de la méthode void Client::accumulerInterets (MoteurInteret& p_moteur) const
+ *        cas valide:
+ *          accumulerInteretsClient: seuls les comptes epargne du client sont ajoutés au lot
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST_F(UnMoteurInteret, accumulerInteretsClient)
+{
+  Client client(1001, "Doe", "Jane", util::Date(2, 7, 1972), "333 111 9999");
+  client.ajouterCompte(Epargne(1, 1000, 2.0, "Epargne", util::Date(1, 6, 2020)));
+  client.ajouterCompte(Cheque(2, -500, 2.0, 5));
+  client.ajouterCompte(Epargne(3, 500, 2.0, "Epargne", util::Date(1, 6, 2020)));
+
+  client.accumulerInterets(t_moteur);
+  t_moteur.calculer();
+
+  ASSERT_EQ(t_moteur.reqNbrComptes(), 2);
+  ASSERT_DOUBLE_EQ(t_moteur.reqTotal(), 30.0);
+}
@@ -0,0 +1,55 @@
+/**
+ * \file NiveauxContratAucun.cpp
+ * \brief Test unitaire des niveaux de vérification de la théorie du contrat, niveau aucun
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          PRECONDITION, POSTCONDITION, INVARIANT, ASSERTION
+ *          PRECONDITION_AUDIT, POSTCONDITION_AUDIT, INVARIANT_AUDIT, ASSERTION_AUDIT
+ *
+ * Compilé au niveau CONTRAT_NIVEAU_AUCUN et lié avec NiveauxContratTesteur.cpp.
+ */
+#undef CONTRAT_NIVEAU
+#define CONTRAT_NIVEAU CONTRAT_NIVEAU_AUCUN
+
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "ContratException.h"
+
+namespace
+{
+int nbEvaluations = 0;
+
+/**
+ * \brief Retourne p_resultat en comptant l'évaluation, pour savoir si une vérification a été compilée
+ */
+[[maybe_unused]] bool evaluer (bool p_resultat)
+{
+  nbEvaluations++;
+  return p_resultat;
+}
+}
+
+
+/**
+ * \brief Test du niveau CONTRAT_NIVEAU_AUCUN
+ *        cas valide:
+ *          aucun d'identifié
+ *        cas invalide:
+ *          toutRetire: conditions brisées, aucune vérification n'est évaluée ni lancée
+ */
+TEST(NiveauAucun, toutRetire)
+{
+  nbEvaluations = 0;
+  ASSERT_NO_THROW(PRECONDITION(evaluer(false)));
+  ASSERT_NO_THROW(POSTCONDITION(evaluer(false)));
+  ASSERT_NO_THROW(INVARIANT(evaluer(false)));
+  ASSERT_NO_THROW(ASSERTION(evaluer(false)));
+  ASSERT_NO_THROW(PRECONDITION_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(POSTCONDITION_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(INVARIANT_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(ASSERTION_AUDIT(evaluer(false)));
+  ASSERT_EQ(nbEvaluations, 0);
+}
@@ -0,0 +1,70 @@
+/**
+ * \file NiveauxContratTesteur.cpp
+ * \brief Test unitaire des niveaux de vérification de la théorie du contrat, niveau par défaut
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          PRECONDITION, POSTCONDITION, INVARIANT, ASSERTION
+ *          PRECONDITION_AUDIT, POSTCONDITION_AUDIT, INVARIANT_AUDIT, ASSERTION_AUDIT
+ *
+ * Le niveau se choisit par unité de compilation: ce fichier est compilé au niveau
+ * CONTRAT_NIVEAU_DEFAUT et NiveauxContratAucun.cpp, lié au même exécutable, au
+ * niveau CONTRAT_NIVEAU_AUCUN.
+ */
+#undef CONTRAT_NIVEAU
+#define CONTRAT_NIVEAU CONTRAT_NIVEAU_DEFAUT
+
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include "ContratException.h"
+
+namespace
+{
+int nbEvaluations = 0;
+
+/**
+ * \brief Retourne p_resultat en comptant l'évaluation, pour savoir si une vérification a été compilée
+ */
+bool evaluer (bool p_resultat)
+{
+  nbEvaluations++;
+  return p_resultat;
+}
+}
+
+
+/**
+ * \brief Test du niveau CONTRAT_NIVEAU_DEFAUT
+ *        cas valides:
+ *          verificationsConservees: conditions respectées, toutes les vérifications évaluées
+ *          auditRetire: les vérifications AUDIT ne sont ni évaluées ni lancées
+ *        cas invalide:
+ *          verificationsLancees: conditions brisées, chaque macro lance son exception
+ */
+TEST(NiveauDefaut, verificationsConservees)
+{
+  nbEvaluations = 0;
+  ASSERT_NO_THROW(PRECONDITION(evaluer(true)));
+  ASSERT_NO_THROW(POSTCONDITION(evaluer(true)));
+  ASSERT_NO_THROW(INVARIANT(evaluer(true)));
+  ASSERT_NO_THROW(ASSERTION(evaluer(true)));
+  ASSERT_EQ(nbEvaluations, 4);
+}
+TEST(NiveauDefaut, auditRetire)
+{
+  nbEvaluations = 0;
+  ASSERT_NO_THROW(PRECONDITION_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(POSTCONDITION_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(INVARIANT_AUDIT(evaluer(false)));
+  ASSERT_NO_THROW(ASSERTION_AUDIT(evaluer(false)));
+  ASSERT_EQ(nbEvaluations, 0);
+}
+TEST(NiveauDefaut, verificationsLancees)
+{
+  ASSERT_THROW(PRECONDITION(evaluer(false)), PreconditionException);
+  ASSERT_THROW(POSTCONDITION(evaluer(false)), PostconditionException);
+  ASSERT_THROW(INVARIANT(evaluer(false)), InvariantException);
+  ASSERT_THROW(ASSERTION(evaluer(false)), AssertionException);
+}
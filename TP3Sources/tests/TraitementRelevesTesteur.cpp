@@ -0,0 +1,127 @@
+/**
+ * \file TraitementRelevesTesteur.cpp
+ * \brief Test unitaire de la classe TraitementReleves
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          TraitementReleves(const Banque& p_banque, unsigned p_nbFils);
+ *          StatistiquesReleves genererFichiers(const std::string& p_repertoire) const;
+ *          StatistiquesReleves genererFichierUnique(int p_descripteur) const;
+ *          unsigned reqNbFils() const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Date.h"
+#include "Cheque.h"
+#include "Epargne.h"
+#include "Client.h"
+#include "Banque.h"
+#include "TraitementReleves.h"
+
+using namespace std;
+using namespace bancaire;
+
+/**
+ * \class UneBanqueDeClients
+ * \brief création d'une fixture: 300 clients répartis sur tous les folios, avec des comptes
+ */
+class UneBanqueDeClients: public::testing::Test
+{
+public:
+  UneBanqueDeClients ()
+  {
+    for (unsigned noFolio = 1000; noFolio < 10000; noFolio += 30)
+      {
+        Client client(noFolio, "Dortelus", "Judith", util::Date(7, 9, 1988), "418 656-2131");
+        for (unsigned noCompte = 1; noCompte <= noFolio % 5; noCompte++)
+          {
+            client.ajouterCompte(Epargne(noCompte, noFolio * 1.5, 1.5, "Reer", util::Date(1, 2, 2020)));
+          }
+        t_banque.ajouterClient(client);
+      }
+  }
+  string relevesAttendus () const
+  {
+    string releves;
+    for (unsigned noFolio = 1000; noFolio < 10000; noFolio++)
+      {
+        if (t_banque.estClientPresent(noFolio))
+          {
+            releves += t_banque.reqClient(noFolio).reqReleves();
+          }
+      }
+    return releves;
+  }
+  Banque t_banque;
+};
+
+
+/**
+ * \brief Test des méthodes genererFichierUnique et genererFichiers
+ *        cas valides:
+ *          fichierUniqueOrdonne: même texte qu'une production séquentielle, avec 1 et 4 fils
+ *          fichierParClient: un fichier releve_<folio>.txt par client
+ *          statistiques: nombre de clients, d'octets et latences ordonnées
+ *        cas invalide:
+ *          repertoireAbsent: lance std::runtime_error
+ */
+TEST_F(UneBanqueDeClients, fichierUniqueOrdonne)
+{
+  for (unsigned nbFils : {1u, 4u})
+    {
+      FILE* fichier = tmpfile();
+      TraitementReleves traitement(t_banque, nbFils);
+      ASSERT_EQ(traitement.reqNbFils(), nbFils);
+      traitement.genererFichierUnique(fileno(fichier));
+
+      string contenu;
+      char morceau[4096];
+      rewind(fichier);
+      for (size_t n; (n = fread(morceau, 1, sizeof(morceau), fichier)) > 0; )
+        {
+          contenu.append(morceau, n);
+        }
+      fclose(fichier);
+      ASSERT_EQ(contenu, relevesAttendus());
+    }
+}
+TEST_F(UneBanqueDeClients, fichierParClient)
+{
+  string repertoire = testing::TempDir();
+  TraitementReleves(t_banque, 3).genererFichiers(repertoire);
+
+  for (unsigned noFolio : {1000u, 5500u, 9970u})
+    {
+      string chemin = repertoire + "/releve_" + to_string(noFolio) + ".txt";
+      ifstream fichier(chemin, ios::binary);
+      ostringstream contenu;
+      contenu << fichier.rdbuf();
+      ASSERT_EQ(contenu.str(), t_banque.reqClient(noFolio).reqReleves());
+    }
+  for (unsigned noFolio = 1000; noFolio < 10000; noFolio += 30)
+    {
+      remove((repertoire + "/releve_" + to_string(noFolio) + ".txt").c_str());
+    }
+}
+TEST_F(UneBanqueDeClients, statistiques)
+{
+  FILE* fichier = tmpfile();
+  StatistiquesReleves statistiques = TraitementReleves(t_banque, 2).genererFichierUnique(fileno(fichier));
+  fclose(fichier);
+
+  ASSERT_EQ(statistiques.m_nbrClients, t_banque.reqNbrClients());
+  ASSERT_EQ(statistiques.m_nbrOctets, relevesAttendus().size());
+  ASSERT_LE(statistiques.m_latenceP50Microsecondes, statistiques.m_latenceP99Microsecondes);
+  ASSERT_LE(statistiques.m_latenceP99Microsecondes, statistiques.m_latenceMaxMicrosecondes);
+}
+TEST_F(UneBanqueDeClients, repertoireAbsent)
+{
+  ASSERT_THROW(TraitementReleves(t_banque, 2).genererFichiers("/inexistant/releves"), std::runtime_error);
+}
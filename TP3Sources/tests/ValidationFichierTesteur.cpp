@@ -0,0 +1,184 @@
+/**
+ * \file ValidationFichierTesteur.cpp
+ * \brief Test unitaire des fonctions de validationFichier
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          std::vector<ErreurEnregistrement> validerEnregistrements(std::string_view p_contenu, unsigned p_nbFils);
+ *          std::vector<ErreurEnregistrement> validerFichierVolumineux(const std::string& p_chemin, unsigned p_nbFils);
+ *          FichierProjete::FichierProjete(const std::string& p_chemin);
+ *          std::string_view FichierProjete::reqContenu() const;
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "validationFichier.h"
+
+using namespace std;
+using namespace util;
+
+namespace
+{
+const string CLIENT_VALIDE =
+  "Dortelus\nJudith\n07 09 1988\n418 656-2131\n3333\n"
+  "cheque\n20\n2.3\n100.50\nCompte courant\n3\n0.1\n"
+  "epargne\n21\n1.5\n2000\nReer\n0\n01 01 2020\n";
+}
+
+/**
+ * \class UnFichierMultiClients
+ * \brief création d'une fixture: trois clients dont le deuxième a un folio invalide
+ *        et le troisième un compte d'épargne au solde invalide
+ */
+class UnFichierMultiClients: public::testing::Test
+{
+public:
+  UnFichierMultiClients ()
+  {
+    t_contenu = CLIENT_VALIDE + "\n"
+      + "Tremblay\nMarc\n01 02 1970\n418 555-0000\n999\ncheque\n1\n1\n1\nx\n1\n1\n\n"
+      + "Roy\nAnne\n15 06 1999\n514 555-1234\n4444\n"
+      + "epargne\n7\n1\nabc\nReer\n0\n01 01 2020\n"
+      + "cheque\n8\n1\n10\nCourant\n1\n0\n";
+  }
+  string t_contenu;
+};
+
+
+/**
+ * \brief Test de la fonction validerEnregistrements
+ *        cas valides:
+ *          contenuValide: plusieurs clients valides, fin de ligne Windows, contenu vide
+ *        cas invalides:
+ *          positionErreurs: folio invalide et solde invalide, position et ligne de l'enregistrement
+ *          marqueurInvalide: ligne de compte qui n'est ni cheque ni epargne
+ *          resultatIndependantDuNombreDeFils: mêmes erreurs avec 1, 2 ou 5 fils
+ *          contenuVolumineux: contenu Unix de plusieurs Mo découpé en 64 régions, avec ou sans
+ *                             lignes vides, mêmes erreurs qu'avec un seul fil
+ */
+TEST(ValidationFichier, contenuValide)
+{
+  string windows = CLIENT_VALIDE;
+  for (size_t i = windows.find('\n'); i != string::npos; i = windows.find('\n', i + 2))
+    {
+      windows.insert(i, "\r");
+    }
+  ASSERT_TRUE(validerEnregistrements(CLIENT_VALIDE + "\n" + CLIENT_VALIDE).empty());
+  ASSERT_TRUE(validerEnregistrements(windows + "\r\n" + windows, 2).empty());
+  ASSERT_TRUE(validerEnregistrements("").empty());
+}
+TEST_F(UnFichierMultiClients, positionErreurs)
+{
+  vector<ErreurEnregistrement> erreurs = validerEnregistrements(t_contenu, 1);
+  ASSERT_EQ(erreurs.size(), 2);
+  ASSERT_EQ(erreurs[0].m_position, CLIENT_VALIDE.size() + 1);
+  ASSERT_EQ(erreurs[0].m_ligne, 21);
+  ASSERT_STREQ(erreurs[0].m_raison, "folio invalide");
+  ASSERT_EQ(erreurs[1].m_position, t_contenu.find("epargne\n7"));
+  ASSERT_EQ(erreurs[1].m_ligne, 39);
+  ASSERT_STREQ(erreurs[1].m_raison, "solde invalide");
+}
+TEST(ValidationFichier, marqueurInvalide)
+{
+  vector<ErreurEnregistrement> erreurs = validerEnregistrements(CLIENT_VALIDE + "courant\n20\n");
+  ASSERT_EQ(erreurs.size(), 1);
+  ASSERT_EQ(erreurs[0].m_ligne, 20);
+  ASSERT_STREQ(erreurs[0].m_raison, "marqueur cheque ou epargne attendu");
+}
+TEST_F(UnFichierMultiClients, resultatIndependantDuNombreDeFils)
+{
+  vector<ErreurEnregistrement> reference = validerEnregistrements(t_contenu, 1);
+  for (unsigned nbFils : {2u, 5u})
+    {
+      vector<ErreurEnregistrement> erreurs = validerEnregistrements(t_contenu, nbFils);
+      ASSERT_EQ(erreurs.size(), reference.size());
+      for (size_t i = 0; i < erreurs.size(); i++)
+        {
+          ASSERT_EQ(erreurs[i].m_position, reference[i].m_position);
+          ASSERT_EQ(erreurs[i].m_ligne, reference[i].m_ligne);
+        }
+    }
+}
+TEST(ValidationFichier, contenuVolumineux)
+{
+  const string compte = "cheque\n20\n2.3\n100.50\nCompte courant\n3\n0.1\n";
+  string plusieursClients;
+  string unSeulClient = CLIENT_VALIDE;
+  while (plusieursClients.size() < (4 << 20))
+    {
+      plusieursClients += CLIENT_VALIDE + "\n";
+      unSeulClient += compte;
+    }
+  plusieursClients += "Roy\nAnne\n15 06 1999\n514 555-1234\n4444\nepargne\n7\n1\nabc\nReer\n0\n01 01 2020\n";
+  unSeulClient += "courant\n20\n";
+  for (const string& contenu : {plusieursClients, unSeulClient})
+    {
+      vector<ErreurEnregistrement> reference = validerEnregistrements(contenu, 1);
+      vector<ErreurEnregistrement> erreurs = validerEnregistrements(contenu, 64);
+      ASSERT_EQ(reference.size(), 1);
+      ASSERT_EQ(erreurs.size(), 1);
+      ASSERT_EQ(erreurs[0].m_position, reference[0].m_position);
+      ASSERT_EQ(erreurs[0].m_ligne, reference[0].m_ligne);
+    }
+}
+
+
+/**
+ * \brief Test de la fonction validerFichierVolumineux
+ *        cas valide:
+ *          fichierProjete: mêmes erreurs que sur le contenu en mémoire
+ *        cas invalide:
+ *          fichierAbsent: lance std::runtime_error
+ */
+TEST_F(UnFichierMultiClients, fichierProjete)
+{
+  string chemin = testing::TempDir() + "ValidationFichierTesteur.txt";
+  ofstream(chemin, ios::binary) << t_contenu;
+  vector<ErreurEnregistrement> erreurs = validerFichierVolumineux(chemin, 3);
+  remove(chemin.c_str());
+  ASSERT_EQ(erreurs.size(), 2);
+  ASSERT_EQ(erreurs[1].m_ligne, 39);
+}
+TEST(ValidationFichier, fichierAbsent)
+{
+  ASSERT_THROW(validerFichierVolumineux("/inexistant/ValidationFichierTesteur.txt"), std::runtime_error);
+}
+
+
+/**
+ * \brief Test de la classe FichierProjete
+ *        cas valides:
+ *          contenu: la vue couvre exactement le contenu du fichier
+ *          fichierVide: vue vide
+ *        cas invalide:
+ *          projectionAbsente: lance std::runtime_error
+ */
+TEST_F(UnFichierMultiClients, contenu)
+{
+  string chemin = testing::TempDir() + "FichierProjete.txt";
+  ofstream(chemin, ios::binary) << t_contenu;
+  {
+    FichierProjete fichier(chemin);
+    ASSERT_EQ(fichier.reqContenu(), t_contenu);
+  }
+  remove(chemin.c_str());
+}
+TEST(FichierProjete, fichierVide)
+{
+  string chemin = testing::TempDir() + "FichierProjeteVide.txt";
+  ofstream(chemin, ios::binary).close();
+  {
+    FichierProjete fichier(chemin);
+    ASSERT_TRUE(fichier.reqContenu().empty());
+  }
+  remove(chemin.c_str());
+}
+TEST(FichierProjete, projectionAbsente)
+{
+  ASSERT_THROW(FichierProjete("/inexistant/FichierProjete.txt"), std::runtime_error);
+}
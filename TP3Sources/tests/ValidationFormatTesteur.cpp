@@ -0,0 +1,337 @@
+/**
+ * \file ValidationFormatTesteur.cpp
+ * \brief Test unitaire des fonctions de validationFormat
+ * \author Judith-Aisha Dortélus
+ * \version 1.0
+ * \    10/19/2026
+ * A tester:
+ *          bool validerLettreAccent(char c);
+ *          bool estLettreAccentuee(char32_t p_pointCode);
+ *          bool decoderUtf8(std::string_view p_texte, std::size_t& p_position, char32_t& p_pointCode);
+ *          bool validerFormatNom(std::string_view p_nom);
+ *          std::vector<std::uint64_t> validerColonneNoms(const std::vector<std::string_view>& p_noms);
+ *          bool validerFormatDate (std::string_view p_ligne, int& p_jour, int& p_mois, int& p_annee);
+ *          bool lireDate (std::string_view p_champ, Date& p_date);
+ *          ColonneDates lireColonneDates (const std::vector<std::string_view>& p_colonne);
+ *          ErreurNombre lireNoFolio, lireNoCompte, lireNbrTransactions, lireTaux, lireSolde
+ */
+#include <stdlib.h>
+#include<gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Date.h"
+#include "validationFormat.h"
+#include "ContratException.h"
+
+using namespace std;
+using namespace util;
+
+/**
+ * \brief Test de la fonction bool decoderUtf8(std::string_view p_texte, std::size_t& p_position, char32_t& p_pointCode)
+ *        cas valide:
+ *          decoderUtf8Valide: séquences de 1, 2, 3 et 4 octets
+ *        cas invalides:
+ *          decoderUtf8_sequenceInvalide: octet de suite isolé, séquence tronquée,
+ *                                        forme trop longue, demi-codet
+ */
+TEST(ValidationFormat, decoderUtf8Valide)
+{
+  string texte = "aé€😀";
+  size_t position = 0;
+  char32_t pointCode = 0;
+  
+  ASSERT_TRUE(decoderUtf8(texte, position, pointCode));
+  ASSERT_EQ(pointCode, U'a');
+  ASSERT_TRUE(decoderUtf8(texte, position, pointCode));
+  ASSERT_EQ(pointCode, U'\u00E9');
+  ASSERT_TRUE(decoderUtf8(texte, position, pointCode));
+  ASSERT_EQ(pointCode, U'\u20AC');
+  ASSERT_TRUE(decoderUtf8(texte, position, pointCode));
+  ASSERT_EQ(pointCode, U'\U0001F600');
+  ASSERT_EQ(position, texte.size());
+}
+TEST(ValidationFormat, decoderUtf8_sequenceInvalide)
+{
+  size_t position = 0;
+  char32_t pointCode = 0;
+  
+  ASSERT_FALSE(decoderUtf8("\xA9", position, pointCode));
+  ASSERT_FALSE(decoderUtf8("\xC3", position, pointCode));
+  ASSERT_FALSE(decoderUtf8("\xC3\xC3", position, pointCode));
+  ASSERT_FALSE(decoderUtf8("\xC1\xA9", position, pointCode));
+  ASSERT_FALSE(decoderUtf8("\xED\xA0\x80", position, pointCode));
+  ASSERT_EQ(position, 0);
+}
+
+
+/**
+ * \brief Test des fonctions bool validerLettreAccent(char c) et bool estLettreAccentuee(char32_t p_pointCode)
+ *        cas valide:
+ *          lettreAccentuee: les lettres de LETTRE_ACCENT
+ *        cas invalide:
+ *          lettreAccentuee_faux: lettres hors de la liste et symboles du bloc Latin-1
+ */
+TEST(ValidationFormat, lettreAccentuee)
+{
+  ASSERT_TRUE(estLettreAccentuee(U'\u00C0'));
+  ASSERT_TRUE(estLettreAccentuee(U'\u00E9'));
+  ASSERT_TRUE(estLettreAccentuee(U'\u00FF'));
+  ASSERT_TRUE(validerLettreAccent('\xC3'));
+}
+TEST(ValidationFormat, lettreAccentuee_faux)
+{
+  ASSERT_FALSE(estLettreAccentuee(U'e'));
+  ASSERT_FALSE(estLettreAccentuee(U'\u00D7'));
+  ASSERT_FALSE(estLettreAccentuee(U'\u00D8'));
+  ASSERT_FALSE(estLettreAccentuee(U'\u0100'));
+  ASSERT_FALSE(validerLettreAccent('e'));
+}
+
+
+/**
+ * \brief Test de la fonction bool validerFormatNom(std::string_view p_nom)
+ *        cas valide:
+ *          formatNomValide: lettres, accents UTF-8, espaces et traits d'union simples
+ *        cas invalides:
+ *          formatNom_separateurInvalide: séparateur au début, à la fin ou double
+ *          formatNom_caractereInvalide: chiffre, ponctuation, accent absent de la liste
+ *          formatNom_utf8Invalide: octets d'accent qui ne forment pas une lettre
+ */
+TEST(ValidationFormat, formatNomValide)
+{
+  ASSERT_TRUE(validerFormatNom("Dortelus"));
+  ASSERT_TRUE(validerFormatNom("Judith-Aisha"));
+  ASSERT_TRUE(validerFormatNom("Michaël Denis"));
+  ASSERT_TRUE(validerFormatNom("Éloïse"));
+}
+TEST(ValidationFormat, formatNom_separateurInvalide)
+{
+  ASSERT_FALSE(validerFormatNom(""));
+  ASSERT_FALSE(validerFormatNom("-Anne"));
+  ASSERT_FALSE(validerFormatNom("Anne "));
+  ASSERT_FALSE(validerFormatNom("Anne--Marie"));
+  ASSERT_FALSE(validerFormatNom("Anne -Marie"));
+}
+TEST(ValidationFormat, formatNom_caractereInvalide)
+{
+  ASSERT_FALSE(validerFormatNom("R2D2"));
+  ASSERT_FALSE(validerFormatNom("O'Neil"));
+  ASSERT_FALSE(validerFormatNom("Søren"));
+}
+TEST(ValidationFormat, formatNom_utf8Invalide)
+{
+  ASSERT_FALSE(validerFormatNom("Ren\xC3\xC3"));
+  ASSERT_FALSE(validerFormatNom("Ren\xA9" "e"));
+  ASSERT_FALSE(validerFormatNom("Ren\xE9"));
+}
+
+
+/**
+ * \brief Test de la fonction std::vector<std::uint64_t> validerColonneNoms(const std::vector<std::string_view>& p_noms)
+ *        cas valide:
+ *          colonneNoms: chaque rang a le même verdict que validerFormatNom, pour des noms
+ *                       courts, plus longs qu'un bloc de 16 octets et accentués
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST(ValidationFormat, colonneNoms)
+{
+  vector<string_view> noms = {"Dortelus", "", "-Anne", "Anne-", "Anne--Marie", "R2D2", "Michaël Denis",
+                              "Ren\xC3\xC3", "Marie-Josephine-Alexandrine", "Marie-Josephine-Alexandrine-", 
+                              "Abcdefghijklmno -Pqr", "Abcdefghijklmno-Pqr", "Abcdefghijklmnop-Qr",
+                              "Abcdefghijklmno--Pqr", "Abcdefghijklmnop Qr1"};
+  while (noms.size() < 70)
+    {
+      noms.push_back(noms.size() % 2 ? "Denis" : "O'Neil");
+    }
+  
+  vector<uint64_t> valides = validerColonneNoms(noms);
+  
+  ASSERT_EQ(valides.size(), 2);
+  for (size_t i = 0; i < noms.size(); i++)
+    {
+      ASSERT_EQ(((valides[i / 64] >> (i % 64)) & 1u) == 1u, validerFormatNom(noms[i])) << "rang " << i;
+    }
+}
+
+
+/**
+ * \brief Test de la fonction bool validerFormatDate (std::string_view p_ligne, int& p_jour, int& p_mois, int& p_annee)
+ *        cas valide:
+ *          formatDateValide: une ligne "JJ MM AAAA" est décodée en jour, mois et année
+ *        cas invalides:
+ *          formatDate_separateurInvalide: un séparateur autre qu'un espace
+ *          formatDate_chiffreInvalide: un caractère autre qu'un chiffre dans un champ numérique
+ *          formatDate_longueurInvalide: une ligne de longueur différente de 10
+ */
+TEST(ValidationFormat, formatDateValide)
+{
+  int jour = 0;
+  int mois = 0;
+  int annee = 0;
+  ASSERT_TRUE(validerFormatDate("07 09 1988", jour, mois, annee));
+  ASSERT_EQ(jour, 7);
+  ASSERT_EQ(mois, 9);
+  ASSERT_EQ(annee, 1988);
+}
+TEST(ValidationFormat, formatDate_separateurInvalide)
+{
+  int jour = 0;
+  int mois = 0;
+  int annee = 0;
+  ASSERT_FALSE(validerFormatDate("07/09/1988", jour, mois, annee));
+  ASSERT_FALSE(validerFormatDate("0709 19888", jour, mois, annee));
+}
+TEST(ValidationFormat, formatDate_chiffreInvalide)
+{
+  int jour = 0;
+  int mois = 0;
+  int annee = 0;
+  ASSERT_FALSE(validerFormatDate("0a 09 1988", jour, mois, annee));
+  ASSERT_FALSE(validerFormatDate("07 09 198:", jour, mois, annee));
+  ASSERT_FALSE(validerFormatDate("07 09 19?8", jour, mois, annee));
+}
+TEST(ValidationFormat, formatDate_longueurInvalide)
+{
+  int jour = 0;
+  int mois = 0;
+  int annee = 0;
+  ASSERT_FALSE(validerFormatDate("7 09 1988", jour, mois, annee));
+  ASSERT_FALSE(validerFormatDate("", jour, mois, annee));
+}
+
+
+/**
+ * \brief Test de la fonction bool lireDate (std::string_view p_champ, Date& p_date)
+ *        cas valide:
+ *          lireDateValide: le champ est converti en Date
+ *        cas invalides:
+ *          lireDate_dateInexistante: 29 février d'une année non bissextile, mois 13
+ *          lireDate_formatInvalide: la date reste inchangée
+ *          lireDate_concordeAvecValiderFormatDate: lireDate et validerFormatDate acceptent
+ *                                                  et refusent les mêmes champs
+ */
+TEST(ValidationFormat, lireDateValide)
+{
+  Date date(1, 1, 2000);
+  ASSERT_TRUE(lireDate("29 02 2024", date));
+  ASSERT_EQ(date, Date(29, 2, 2024));
+}
+TEST(ValidationFormat, lireDate_dateInexistante)
+{
+  Date date(1, 1, 2000);
+  ASSERT_FALSE(lireDate("29 02 2023", date));
+  ASSERT_FALSE(lireDate("01 13 2023", date));
+  ASSERT_FALSE(lireDate("00 01 2023", date));
+}
+TEST(ValidationFormat, lireDate_formatInvalide)
+{
+  Date date(1, 1, 2000);
+  ASSERT_FALSE(lireDate("01-01-2023", date));
+  ASSERT_EQ(date, Date(1, 1, 2000));
+}
+
+TEST(ValidationFormat, lireDate_concordeAvecValiderFormatDate)
+{
+  const vector<string_view> champs = {"29 02 2024", "01 01 2030", "15 06 1999", "31 02 2020", "29 02 2023",
+                                      "31 04 1999", "00 01 2000", "01 13 2000", "01 01 0000"};
+  for (string_view champ: champs)
+    {
+      int jour = 0;
+      int mois = 0;
+      int annee = 0;
+      Date date(1, 1, 2000);
+      ASSERT_EQ(lireDate(champ, date), validerFormatDate(champ, jour, mois, annee)) << champ;
+    }
+  Date date(1, 1, 2000);
+  ASSERT_TRUE(lireDate("01 01 2030", date));
+  ASSERT_FALSE(lireDate("31 02 2020", date));
+}
+
+/**
+ * \brief Test de la fonction ColonneDates lireColonneDates (const std::vector<std::string_view>& p_colonne)
+ *        cas valide:
+ *          lireColonneDates: chaque rang reçoit sa date et son bit de validité,
+ *                            y compris au-delà du premier mot de 64 bits
+ *        cas invalide:
+ *          aucun d'identifié
+ */
+TEST(ValidationFormat, lireColonneDates)
+{
+  vector<string_view> colonne(70, "15 06 1999");
+  colonne[1] = "31 04 1999";
+  colonne[65] = "15-06-1999";
+
+  ColonneDates resultat = lireColonneDates(colonne);
+
+  ASSERT_EQ(resultat.m_dates.size(), 70);
+  ASSERT_EQ(resultat.m_valides.size(), 2);
+  ASSERT_EQ(resultat.m_nbValides, 68);
+  ASSERT_TRUE(resultat.estValide(0));
+  ASSERT_FALSE(resultat.estValide(1));
+  ASSERT_TRUE(resultat.estValide(64));
+  ASSERT_FALSE(resultat.estValide(65));
+  ASSERT_EQ(resultat.m_dates[69], Date(15, 6, 1999));
+  ASSERT_EQ(resultat.m_dates[1], Date(1, 1, 1970));
+}
+
+
+/**
+ * \brief Test des fonctions de lecture des champs numériques
+ *          ErreurNombre lireNoFolio(std::string_view p_champ, unsigned& p_noFolio);
+ *          ErreurNombre lireNoCompte(std::string_view p_champ, unsigned& p_noCompte);
+ *          ErreurNombre lireNbrTransactions(std::string_view p_champ, unsigned& p_nombreTransactions);
+ *          ErreurNombre lireTaux(std::string_view p_champ, double& p_taux);
+ *          ErreurNombre lireSolde(std::string_view p_champ, double& p_solde);
+ *        cas valides:
+ *          lireEntiers: folio, numéro de compte et transactions dans leurs limites
+ *          lireDecimaux: taux et solde en notation décimale, solde négatif
+ *        cas invalides:
+ *          lireEntiers_invalides: champ vide, caractère en trop, signe, hors limites
+ *          lireDecimaux_invalides: virgule, exposant, infini, taux négatif
+ */
+TEST(ValidationFormat, lireEntiers)
+{
+  unsigned valeur = 0;
+  ASSERT_EQ(lireNoFolio("3333", valeur), ErreurNombre::AUCUNE);
+  ASSERT_EQ(valeur, 3333);
+  ASSERT_EQ(lireNoCompte("20", valeur), ErreurNombre::AUCUNE);
+  ASSERT_EQ(valeur, 20);
+  ASSERT_EQ(lireNbrTransactions("0", valeur), ErreurNombre::AUCUNE);
+  ASSERT_EQ(valeur, 0);
+}
+TEST(ValidationFormat, lireEntiers_invalides)
+{
+  unsigned valeur = 7;
+  ASSERT_EQ(lireNoFolio("", valeur), ErreurNombre::VIDE);
+  ASSERT_EQ(lireNoFolio("3333 ", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireNoFolio("999", valeur), ErreurNombre::HORS_LIMITES);
+  ASSERT_EQ(lireNoCompte("-5", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireNoCompte("0", valeur), ErreurNombre::HORS_LIMITES);
+  ASSERT_EQ(lireNoCompte("99999999999", valeur), ErreurNombre::HORS_LIMITES);
+  ASSERT_EQ(lireNbrTransactions("41", valeur), ErreurNombre::HORS_LIMITES);
+  ASSERT_EQ(valeur, 7);
+}
+TEST(ValidationFormat, lireDecimaux)
+{
+  double valeur = 0.0;
+  ASSERT_EQ(lireTaux("2.3", valeur), ErreurNombre::AUCUNE);
+  ASSERT_DOUBLE_EQ(valeur, 2.3);
+  ASSERT_EQ(lireSolde("-33.33", valeur), ErreurNombre::AUCUNE);
+  ASSERT_DOUBLE_EQ(valeur, -33.33);
+  ASSERT_EQ(lireSolde("100", valeur), ErreurNombre::AUCUNE);
+  ASSERT_DOUBLE_EQ(valeur, 100.0);
+}
+TEST(ValidationFormat, lireDecimaux_invalides)
+{
+  double valeur = 1.0;
+  ASSERT_EQ(lireSolde("3,5", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireSolde("1e3", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireSolde("inf", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireSolde("-", valeur), ErreurNombre::FORMAT);
+  ASSERT_EQ(lireTaux("-0.5", valeur), ErreurNombre::HORS_LIMITES);
+  ASSERT_DOUBLE_EQ(valeur, 1.0);
+}
@@ -0,0 +1,307 @@
+/**
+ * \file validationFichier.cpp
+ * \brief Implémentation des fonctions de validationFichier
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#include "validationFichier.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "validationFormat.h"
+#include "Instrumentation.h"
+#include "GroupeFils.h"
+
+using namespace std;
+namespace util
+{
+
+namespace
+{
+const std::size_t TAILLE_MIN_PAR_FIL = 1 << 20;
+
+/**
+ * \brief Lit le champ suivant d'un enregistrement; une ligne vide termine le bloc client et n'est pas consommée
+ */
+bool champSuivant (LecteurLignes& p_lecteur, std::string_view& p_champ)
+{
+  if (p_lecteur.estTermine() || p_lecteur.reqLigne().empty())
+    {
+      return false;
+    }
+  p_champ = p_lecteur.reqLigne();
+  p_lecteur.avancer();
+  return true;
+}
+
+bool estMarqueurCompte (std::string_view p_ligne)
+{
+  return p_ligne == "cheque" || p_ligne == "epargne";
+}
+
+/**
+ * \brief Valide les 5 lignes d'en-tête d'un client, selon les règles de validerFormatFichier
+ * \return la raison de l'échec, nullptr si l'en-tête est valide
+ */
+const char* validerEnTeteClient (LecteurLignes& p_lecteur)
+{
+  std::string_view champ;
+  int jour;
+  int mois;
+  int annee;
+  unsigned noFolio;
+
+  if (!champSuivant(p_lecteur, champ) || !validerFormatNom(champ)) return "nom invalide";
+  if (!champSuivant(p_lecteur, champ) || !validerFormatNom(champ)) return "prénom invalide";
+  if (!champSuivant(p_lecteur, champ) || !validerFormatDate(champ, jour, mois, annee)) return "date de naissance invalide";
+  if (!champSuivant(p_lecteur, champ)) return "téléphone manquant";
+  if (!champSuivant(p_lecteur, champ) || lireNoFolio(champ, noFolio) != ErreurNombre::AUCUNE) return "folio invalide";
+  return nullptr;
+}
+
+/**
+ * \brief Valide un compte débutant par son marqueur "cheque" ou "epargne"
+ * \return la raison de l'échec, nullptr si le compte est valide
+ */
+const char* validerCompte (LecteurLignes& p_lecteur)
+{
+  const bool estCheque = p_lecteur.reqLigne() == "cheque";
+  p_lecteur.avancer();
+
+  std::string_view champ;
+  unsigned entier;
+  double decimal;
+  int jour;
+  int mois;
+  int annee;
+
+  if (!champSuivant(p_lecteur, champ) || lireNoCompte(champ, entier) != ErreurNombre::AUCUNE) return "numéro de compte invalide";
+  if (!champSuivant(p_lecteur, champ) || lireTaux(champ, decimal) != ErreurNombre::AUCUNE) return "taux d'intérêt invalide";
+  if (!champSuivant(p_lecteur, champ) || lireSolde(champ, decimal) != ErreurNombre::AUCUNE) return "solde invalide";
+  if (!champSuivant(p_lecteur, champ)) return "description manquante";
+  if (estCheque)
+    {
+      if (!champSuivant(p_lecteur, champ) || lireNbrTransactions(champ, entier) != ErreurNombre::AUCUNE) return "nombre de transactions invalide";
+      if (!champSuivant(p_lecteur, champ) || lireTaux(champ, decimal) != ErreurNombre::AUCUNE) return "taux d'intérêt minimum invalide";
+    }
+  else
+    {
+      if (!champSuivant(p_lecteur, champ)) return "ligne manquante";
+      if (!champSuivant(p_lecteur, champ) || !validerFormatDate(champ, jour, mois, annee)) return "date invalide";
+    }
+  return nullptr;
+}
+
+/**
+ * \brief Valide les blocs clients d'une région; les numéros de ligne sont relatifs au début de la région
+ */
+void validerRegion (std::string_view p_contenu, std::size_t p_debut, std::size_t p_fin,
+                    std::vector<ErreurEnregistrement>& p_erreurs)
+{
+  LecteurLignes lecteur(p_contenu, p_debut, p_fin);
+
+  while (!lecteur.estTermine())
+    {
+      if (lecteur.reqLigne().empty())
+        {
+          lecteur.avancer();
+          continue;
+        }
+
+      // en-tête client: en cas d'erreur, tout le bloc est ignoré jusqu'à la ligne vide
+      ErreurEnregistrement erreur = {lecteur.reqPosition(), lecteur.reqNoLigne(), nullptr};
+      if ((erreur.m_raison = validerEnTeteClient(lecteur)) != nullptr)
+        {
+          p_erreurs.push_back(erreur);
+          while (!lecteur.estTermine() && !lecteur.reqLigne().empty())
+            {
+              lecteur.avancer();
+            }
+          continue;
+        }
+
+      // comptes: en cas d'erreur, reprise au marqueur suivant
+      while (!lecteur.estTermine() && !lecteur.reqLigne().empty())
+        {
+          erreur = {lecteur.reqPosition(), lecteur.reqNoLigne(), nullptr};
+          if (estMarqueurCompte(lecteur.reqLigne()))
+            {
+              erreur.m_raison = validerCompte(lecteur);
+            }
+          else
+            {
+              erreur.m_raison = "marqueur cheque ou epargne attendu";
+              lecteur.avancer();
+            }
+          if (erreur.m_raison != nullptr)
+            {
+              p_erreurs.push_back(erreur);
+              while (!lecteur.estTermine() && !lecteur.reqLigne().empty() && !estMarqueurCompte(lecteur.reqLigne()))
+                {
+                  lecteur.avancer();
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief Retourne le début de la première ligne vide à partir de p_position, une frontière de bloc client
+ *        Une seule passe vers l'avant, arrêtée au premier saut de ligne suivi d'une ligne vide
+ *        Unix ou Windows: le coût est borné par la distance jusqu'à la frontière.
+ */
+std::size_t frontiereSuivante (std::string_view p_contenu, std::size_t p_position)
+{
+  if (p_position == 0)
+    {
+      return 0;
+    }
+  for (std::size_t saut = p_contenu.find('\n', p_position - 1); saut != std::string_view::npos;
+       saut = p_contenu.find('\n', saut + 1))
+    {
+      std::string_view suite = p_contenu.substr(saut + 1, 2);
+      if ((!suite.empty() && suite[0] == '\n') || suite == "\r\n")
+        {
+          return saut + 1;
+        }
+    }
+  return p_contenu.size();
+}
+
+} // namespace
+
+
+/**
+ * \brief Projette en mémoire, en lecture seule, le fichier complet
+ *        Les pages sont lues à la demande, dans l'ordre: le début du contenu est
+ *        disponible sans attendre la lecture du reste du fichier.
+ * \param[in] p_chemin le chemin du fichier
+ * \exception std::runtime_error si le fichier ne peut pas être ouvert ou projeté
+ */
+FichierProjete::FichierProjete (const std::string& p_chemin) : m_adresse(nullptr), m_taille(0)
+{
+  int descripteur = ::open(p_chemin.c_str(), O_RDONLY);
+  struct stat etat;
+  if (descripteur < 0 || ::fstat(descripteur, &etat) != 0)
+    {
+      if (descripteur >= 0) ::close(descripteur);
+      throw std::runtime_error("Impossible d'ouvrir le fichier " + p_chemin);
+    }
+  m_taille = static_cast<std::size_t>(etat.st_size);
+  if (m_taille > 0)
+    {
+      m_adresse = ::mmap(nullptr, m_taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+      if (m_adresse == MAP_FAILED)
+        {
+          ::close(descripteur);
+          throw std::runtime_error("Impossible de projeter le fichier " + p_chemin);
+        }
+      ::madvise(m_adresse, m_taille, MADV_SEQUENTIAL);
+    }
+  ::close(descripteur);
+}
+
+
+/**
+ * \brief Libère la projection
+ */
+FichierProjete::~FichierProjete ()
+{
+  if (m_adresse != nullptr)
+    {
+      ::munmap(m_adresse, m_taille);
+    }
+}
+
+
+/**
+ * \brief Accesseur du contenu projeté
+ * \return une vue sur le contenu complet, valide pendant la durée de vie de l'objet
+ */
+std::string_view FichierProjete::reqContenu () const
+{
+  return std::string_view(static_cast<const char*>(m_adresse), m_taille);
+}
+
+
+/**
+ * \brief Valide un contenu multi-clients en parallèle
+ *        Le contenu est une suite de blocs clients séparés par des lignes vides, chaque
+ *        bloc ayant le format accepté par validerFormatFichier. Il est découpé en régions
+ *        qui débutent sur une ligne vide, validées chacune par un fil d'exécution.
+ * \param[in] p_contenu le contenu complet du fichier
+ * \param[in] p_nbFils le nombre de fils à utiliser, 0 pour un choix automatique
+ *            (un fil par coeur, au plus un fil par Mo de contenu)
+ * \return les enregistrements invalides, en ordre de position dans le contenu
+ */
+std::vector<ErreurEnregistrement> validerEnregistrements(std::string_view p_contenu, unsigned p_nbFils)
+{
+  MESURER_LATENCE(VALIDATION_FICHIER);
+  std::size_t nbRegions = p_nbFils;
+  if (nbRegions == 0)
+    {
+      nbRegions = std::max(1u, std::thread::hardware_concurrency());
+      nbRegions = std::min(nbRegions, std::max<std::size_t>(1, p_contenu.size() / TAILLE_MIN_PAR_FIL));
+    }
+
+  std::vector<std::size_t> bornes(1, 0);
+  for (std::size_t i = 1; i < nbRegions; i++)
+    {
+      // reprendre à la borne précédente si elle est plus loin: le contenu n'est parcouru qu'une fois
+      bornes.push_back(frontiereSuivante(p_contenu, std::max(bornes.back(), i * (p_contenu.size() / nbRegions))));
+    }
+  bornes.push_back(p_contenu.size());
+
+  std::vector<std::vector<ErreurEnregistrement>> erreursParRegion(nbRegions);
+  std::vector<std::uint64_t> lignesParRegion(nbRegions);
+  auto valider = [&] (std::size_t i)
+    {
+      validerRegion(p_contenu, bornes[i], bornes[i + 1], erreursParRegion[i]);
+      lignesParRegion[i] = std::count(p_contenu.begin() + bornes[i], p_contenu.begin() + bornes[i + 1], '\n');
+    };
+
+  GroupeFils fils;
+  for (std::size_t i = 1; i < nbRegions; i++)
+    {
+      fils.lancer([&valider, i] { valider(i); });
+    }
+  valider(0);
+  fils.joindre();
+
+  std::vector<ErreurEnregistrement> erreurs;
+  std::uint64_t lignesPrecedentes = 0;
+  for (std::size_t i = 0; i < nbRegions; i++)
+    {
+      for (ErreurEnregistrement erreur : erreursParRegion[i])
+        {
+          erreur.m_ligne += lignesPrecedentes + 1;
+          erreurs.push_back(erreur);
+        }
+      lignesPrecedentes += lignesParRegion[i];
+    }
+  return erreurs;
+}
+
+
+/**
+ * \brief Valide en parallèle un fichier multi-clients projeté en mémoire
+ * \param[in] p_chemin le chemin du fichier
+ * \param[in] p_nbFils le nombre de fils à utiliser, 0 pour un choix automatique
+ * \return les enregistrements invalides, en ordre de position dans le fichier
+ * \exception std::runtime_error si le fichier ne peut pas être ouvert ou projeté
+ */
+std::vector<ErreurEnregistrement> validerFichierVolumineux(const std::string& p_chemin, unsigned p_nbFils)
+{
+  FichierProjete fichier(p_chemin);
+  return validerEnregistrements(fichier.reqContenu(), p_nbFils);
+}
+
+} // namespace util
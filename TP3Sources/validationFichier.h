@@ -0,0 +1,107 @@
+/**
+ * \file validationFichier.h
+ * \brief Fichier qui contient la déclaration des fonctions de validation des fichiers multi-clients volumineux.
+ * \author Judith-Aisha Dortelus
+ * \version 1.0
+ * \    10/19/2026
+ */
+
+#ifndef VALIDATIONFICHIER_H
+#define VALIDATIONFICHIER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace util
+{
+/**
+ * \struct ErreurEnregistrement
+ * \brief Position d'un enregistrement invalide dans un fichier multi-clients.
+ *
+ *              m_position est le décalage en octets du début de l'enregistrement,
+ *              m_ligne son numéro de ligne (à partir de 1) et m_raison une courte
+ *              description de la première règle non respectée.
+ */
+struct ErreurEnregistrement
+{
+  std::uint64_t m_position;
+  std::uint64_t m_ligne;
+  const char* m_raison;
+};
+
+/**
+ * \class LecteurLignes
+ * \brief Parcourt sans copie les lignes d'une région [debut, fin[ d'un contenu.
+ *        La ligne courante est retournée sans sa fin de ligne ("\n" ou "\r\n").
+ */
+class LecteurLignes
+{
+public:
+  LecteurLignes (std::string_view p_contenu, std::size_t p_debut, std::size_t p_fin)
+    : m_contenu(p_contenu), m_position(p_debut), m_fin(p_fin), m_noLigne(0)
+  {
+    chercherFinLigne();
+  }
+
+  bool estTermine () const { return m_position >= m_fin; }
+  std::size_t reqPosition () const { return m_position; }
+  std::uint64_t reqNoLigne () const { return m_noLigne; }
+  std::string_view reqLigne () const { return m_ligne; }
+
+  void avancer ()
+  {
+    m_position = m_finLigne;
+    m_noLigne++;
+    chercherFinLigne();
+  }
+
+private:
+  void chercherFinLigne ()
+  {
+    std::size_t saut = std::min(m_contenu.find('\n', m_position), m_fin);
+    m_finLigne = saut < m_fin ? saut + 1 : m_fin;
+    m_ligne = m_contenu.substr(m_position, saut - m_position);
+    if (!m_ligne.empty() && m_ligne.back() == '\r')
+      {
+        m_ligne.remove_suffix(1);
+      }
+  }
+
+  std::string_view m_contenu;
+  std::size_t m_position;
+  std::size_t m_fin;
+  std::size_t m_finLigne;
+  std::uint64_t m_noLigne;
+  std::string_view m_ligne;
+};
+
+/**
+ * \class FichierProjete
+ * \brief Projection en mémoire, en lecture seule, d'un fichier complet.
+ *        Donne accès au contenu par une vue, sans le copier dans une chaîne.
+ */
+class FichierProjete
+{
+public:
+  explicit FichierProjete (const std::string& p_chemin);
+  ~FichierProjete ();
+
+  FichierProjete (const FichierProjete&) = delete;
+  FichierProjete& operator= (const FichierProjete&) = delete;
+
+  std::string_view reqContenu () const;
+
+private:
+  void* m_adresse;
+  std::size_t m_taille;
+};
+
+std::vector<ErreurEnregistrement> validerEnregistrements(std::string_view p_contenu, unsigned p_nbFils = 0);
+std::vector<ErreurEnregistrement> validerFichierVolumineux(const std::string& p_chemin, unsigned p_nbFils = 0);
+
+} // namespace util
+
+#endif /* VALIDATIONFICHIER_H */
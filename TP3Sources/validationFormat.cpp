@@ -10,83 +10,422 @@
 #include <iostream>
 #include <sstream>
 #include <cctype>
+#include <cstring>
+#include <cmath>
+#include <charconv>
 #include <string>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "Date.h"
 #include "Compte.h"
+#include "Instrumentation.h"
 
 using namespace std;
 namespace util
 {
 
+namespace
+{
+const std::uint64_t OCTETS_30 = 0x3030303030303030ULL;
+const std::uint64_t OCTETS_06 = 0x0606060606060606ULL;
+const std::uint64_t OCTETS_F0 = 0xF0F0F0F0F0F0F0F0ULL;
+const std::uint64_t MASQUE_SEPARATEURS = 0x0000FF0000FF0000ULL;  // octets 2 et 5
+const std::uint64_t SEPARATEURS_ESPACE = 0x0000200000200000ULL;
+const std::uint64_t SEPARATEURS_ZERO = 0x0000300000300000ULL;
+
+/**
+ * \brief Charge 8 octets dans un mot, l'octet p[0] dans les bits de poids faible
+ */
+std::uint64_t chargerMot (const char* p)
+{
+  std::uint64_t mot = 0;
+  for (int i = 7; i >= 0; i--)
+    {
+      mot = (mot << 8) | static_cast<unsigned char>(p[i]);
+    }
+  return mot;
+}
+
+/**
+ * \brief Vérifie en parallèle (SWAR) que les 8 octets du mot sont des chiffres '0'..'9'
+ */
+bool sontChiffres (std::uint64_t p_mot)
+{
+  return (p_mot & OCTETS_F0) == OCTETS_30 && ((p_mot + OCTETS_06) & OCTETS_F0) == OCTETS_30;
+}
+
+bool estChiffre (char c)
+{
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+/**
+ * \brief Décode les 10 caractères "JJ MM AAAA" pointés par p_champ
+ *        Les 8 premiers octets sont validés d'un seul coup sur un mot de 64 bits,
+ *        les deux derniers chiffres de l'année séparément.
+ * \return un booléen indiquant si le champ a le bon format; les paramètres
+ *         de sortie ne sont assignés que dans ce cas
+ */
+bool decoderChampDate (const char* p_champ, int& p_jour, int& p_mois, int& p_annee)
+{
+  std::uint64_t mot = chargerMot(p_champ);
+  if ((mot & MASQUE_SEPARATEURS) != SEPARATEURS_ESPACE)
+    {
+      return false;
+    }
+  mot = (mot & ~MASQUE_SEPARATEURS) | SEPARATEURS_ZERO;
+  if (!sontChiffres(mot) || !estChiffre(p_champ[8]) || !estChiffre(p_champ[9]))
+    {
+      return false;
+    }
+  
+  const std::uint64_t chiffres = mot - OCTETS_30;
+  auto octet = [chiffres] (int i) { return static_cast<int>((chiffres >> (8 * i)) & 0xFF); };
+  
+  p_jour = octet(0) * 10 + octet(1);
+  p_mois = octet(3) * 10 + octet(4);
+  p_annee = octet(6) * 1000 + octet(7) * 100 + (p_champ[8] - '0') * 10 + (p_champ[9] - '0');
+  return true;
+}
+
+/**
+ * \brief Classe d'un octet pour la validation des noms
+ */
+enum ClasseOctet : unsigned char { AUTRE = 0, LETTRE, SEPARATEUR, NON_ASCII };
+
+constexpr std::array<unsigned char, 256> construireTableClasses ()
+{
+  std::array<unsigned char, 256> table {};
+  for (int c = 'A'; c <= 'Z'; c++)
+    {
+      table[c] = LETTRE;
+      table[c - 'A' + 'a'] = LETTRE;
+    }
+  table[' '] = SEPARATEUR;
+  table['-'] = SEPARATEUR;
+  for (int c = 0x80; c < 0x100; c++)
+    {
+      table[c] = NON_ASCII;
+    }
+  return table;
+}
+
+constexpr std::array<unsigned char, 256> TABLE_CLASSES = construireTableClasses();
+
+ClasseOctet classeDe (char c)
+{
+  return static_cast<ClasseOctet>(TABLE_CLASSES[static_cast<unsigned char>(c)]);
+}
+
+/**
+ * \brief Masque des lettres de LETTRE_ACCENT: le bit i représente le point de code U+00C0 + i.
+ *        Toutes les lettres de la liste sont des séquences UTF-8 de deux octets.
+ */
+constexpr std::uint64_t construireMasqueAccents ()
+{
+  std::uint64_t masque = 0;
+  for (int i = 0; LETTRE_ACCENT[i] != '\0' && LETTRE_ACCENT[i + 1] != '\0'; i += 2)
+    {
+      char32_t pointCode = ((static_cast<unsigned char>(LETTRE_ACCENT[i]) & 0x1F) << 6)
+                           | (static_cast<unsigned char>(LETTRE_ACCENT[i + 1]) & 0x3F);
+      masque |= std::uint64_t(1) << (pointCode - 0xC0);
+    }
+  return masque;
+}
+
+constexpr std::uint64_t MASQUE_ACCENTS = construireMasqueAccents();
+
+/**
+ * \brief Ensemble des octets apparaissant dans LETTRE_ACCENT, un bit par valeur d'octet
+ */
+constexpr std::array<std::uint64_t, 4> construireOctetsAccent ()
+{
+  std::array<std::uint64_t, 4> octets {};
+  for (int i = 0; LETTRE_ACCENT[i] != '\0'; i++)
+    {
+      unsigned char c = static_cast<unsigned char>(LETTRE_ACCENT[i]);
+      octets[c / 64] |= std::uint64_t(1) << (c % 64);
+    }
+  return octets;
+}
+
+constexpr std::array<std::uint64_t, 4> OCTETS_ACCENT = construireOctetsAccent();
+
+/**
+ * \brief Lit un entier non signé occupant tout le champ, sans dépendre de la locale
+ */
+ErreurNombre lireEntier (std::string_view p_champ, unsigned& p_valeur)
+{
+  if (p_champ.empty())
+    {
+      return ErreurNombre::VIDE;
+    }
+  unsigned valeur;
+  auto [fin, erreur] = std::from_chars(p_champ.data(), p_champ.data() + p_champ.size(), valeur);
+  if (erreur == std::errc::result_out_of_range)
+    {
+      return ErreurNombre::HORS_LIMITES;
+    }
+  if (erreur != std::errc() || fin != p_champ.data() + p_champ.size())
+    {
+      return ErreurNombre::FORMAT;
+    }
+  p_valeur = valeur;
+  return ErreurNombre::AUCUNE;
+}
+
+/**
+ * \brief Lit un nombre décimal fini occupant tout le champ, sans dépendre de la locale
+ */
+ErreurNombre lireDecimal (std::string_view p_champ, double& p_valeur)
+{
+  if (p_champ.empty())
+    {
+      return ErreurNombre::VIDE;
+    }
+  double valeur;
+  auto [fin, erreur] = std::from_chars(p_champ.data(), p_champ.data() + p_champ.size(), valeur,
+                                       std::chars_format::fixed);
+  if (erreur == std::errc::result_out_of_range)
+    {
+      return ErreurNombre::HORS_LIMITES;
+    }
+  if (erreur != std::errc() || fin != p_champ.data() + p_champ.size() || !std::isfinite(valeur))
+    {
+      return ErreurNombre::FORMAT;
+    }
+  p_valeur = valeur;
+  return ErreurNombre::AUCUNE;
+}
+
+/**
+ * \brief Résultat de la validation vectorielle d'un nom
+ */
+enum VerdictNom { NOM_INVALIDE, NOM_VALIDE, NOM_NON_ASCII };
+
+#if defined(__SSE2__)
+/**
+ * \brief Valide un nom ASCII par blocs de 16 octets avec SSE2
+ *        Chaque bloc est classé en lettres et séparateurs par comparaisons vectorielles,
+ *        puis les règles sont vérifiées sur les masques de bits obtenus. Le dernier bloc
+ *        incomplet est recopié dans un tampon pour ne jamais lire au-delà du nom.
+ * \return NOM_NON_ASCII dès qu'un octet non ASCII est rencontré, le nom devant alors
+ *         être validé par validerFormatNom
+ */
+VerdictNom validerNomVectoriel (std::string_view p_nom)
+{
+  const __m128i minuscule = _mm_set1_epi8(0x20);
+  const __m128i avantA = _mm_set1_epi8('a' - 1);
+  const __m128i apresZ = _mm_set1_epi8('z' + 1);
+  const __m128i espace = _mm_set1_epi8(' ');
+  const __m128i trait = _mm_set1_epi8('-');
+  
+  bool separateurPrecedent = false;
+  for (std::size_t debut = 0; debut < p_nom.size(); debut += 16)
+    {
+      std::size_t taille = std::min<std::size_t>(16, p_nom.size() - debut);
+      __m128i bloc;
+      if (taille == 16)
+        {
+          bloc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_nom.data() + debut));
+        }
+      else
+        {
+          alignas(16) char tampon[16] = {};
+          std::memcpy(tampon, p_nom.data() + debut, taille);
+          bloc = _mm_load_si128(reinterpret_cast<const __m128i*>(tampon));
+        }
+      const unsigned presents = (1u << taille) - 1;
+      
+      if (_mm_movemask_epi8(bloc) & presents)
+        {
+          return NOM_NON_ASCII;
+        }
+      __m128i lettre = _mm_or_si128(bloc, minuscule);
+      lettre = _mm_and_si128(_mm_cmpgt_epi8(lettre, avantA), _mm_cmplt_epi8(lettre, apresZ));
+      __m128i separateur = _mm_or_si128(_mm_cmpeq_epi8(bloc, espace), _mm_cmpeq_epi8(bloc, trait));
+      
+      unsigned masqueSeparateurs = _mm_movemask_epi8(separateur) & presents;
+      unsigned masqueAcceptes = (_mm_movemask_epi8(lettre) & presents) | masqueSeparateurs;
+      if (masqueAcceptes != presents)
+        {
+          return NOM_INVALIDE;
+        }
+      if ((masqueSeparateurs & (masqueSeparateurs >> 1)) || (separateurPrecedent && (masqueSeparateurs & 1u)))
+        {
+          return NOM_INVALIDE;
+        }
+      separateurPrecedent = (masqueSeparateurs >> (taille - 1)) & 1u;
+    }
+  return NOM_VALIDE;
+}
+#else
+VerdictNom validerNomVectoriel (std::string_view)
+{
+  return NOM_NON_ASCII;
+}
+#endif
+} // namespace
+
 /** 
- * \brief valide si le caractère contient un accent ou non
- * \param[in] c un caractère représentant une lettre à valider dans une chaîne de caractères
- * \return un booléen indiquant si le caractère est un accent ou non
+ * \brief valide si l'octet fait partie de l'encodage UTF-8 d'une lettre de LETTRE_ACCENT
+ *        Cette vérification octet par octet ne garantit pas qu'une séquence est une lettre
+ *        accentuée, utiliser decoderUtf8 et estLettreAccentuee pour cela.
+ * \param[in] c un octet d'une chaîne de caractères encodée en UTF-8
+ * \return un booléen indiquant si l'octet apparaît dans LETTRE_ACCENT
  */
 bool validerLettreAccent(char c)
 {
-  bool valide = false;
-  for (int i = 0; LETTRE_ACCENT[i] != '\0'; i++)
+  return (OCTETS_ACCENT[static_cast<unsigned char>(c) / 64] >> (static_cast<unsigned char>(c) % 64)) & 1u;
+}
+
+/** 
+ * \brief valide si un point de code Unicode est une lettre accentuée de LETTRE_ACCENT
+ * \param[in] p_pointCode le point de code à vérifier
+ * \return un booléen indiquant si le point de code est une lettre accentuée acceptée
+ */
+bool estLettreAccentuee(char32_t p_pointCode)
+{
+  return p_pointCode >= 0xC0 && p_pointCode <= 0xFF && ((MASQUE_ACCENTS >> (p_pointCode - 0xC0)) & 1u);
+}
+
+/** 
+ * \brief décode le point de code UTF-8 débutant à une position d'une chaîne
+ *        Les séquences tronquées, les formes trop longues, les demi-codets (surrogates)
+ *        et les points de code au-delà de U+10FFFF sont refusés.
+ * \param[in] p_texte la chaîne encodée en UTF-8
+ * \param[in,out] p_position la position du premier octet, avancée après la séquence si elle est valide
+ * \param[out] p_pointCode le point de code décodé
+ * \return un booléen indiquant si la séquence est valide
+ */
+bool decoderUtf8(std::string_view p_texte, std::size_t& p_position, char32_t& p_pointCode)
+{
+  if (p_position >= p_texte.size())
+    {
+      return false;
+    }
+  unsigned char premier = p_texte[p_position];
+  int longueur;
+  char32_t pointCode;
+  char32_t minimum;
+  
+  if (premier < 0x80)      { longueur = 1; pointCode = premier;        minimum = 0; }
+  else if (premier < 0xC2) { return false; }
+  else if (premier < 0xE0) { longueur = 2; pointCode = premier & 0x1F; minimum = 0x80; }
+  else if (premier < 0xF0) { longueur = 3; pointCode = premier & 0x0F; minimum = 0x800; }
+  else if (premier < 0xF5) { longueur = 4; pointCode = premier & 0x07; minimum = 0x10000; }
+  else { return false; }
+  
+  if (p_texte.size() - p_position < static_cast<std::size_t>(longueur))
+    {
+      return false;
+    }
+  for (int i = 1; i < longueur; i++)
     {
-      if (c == LETTRE_ACCENT[i])
+      unsigned char suite = p_texte[p_position + i];
+      if ((suite & 0xC0) != 0x80)
         {
-          valide = true;
+          return false;
         }
+      pointCode = (pointCode << 6) | (suite & 0x3F);
     }
-  return valide;
+  if (pointCode < minimum || pointCode > 0x10FFFF || (pointCode >= 0xD800 && pointCode <= 0xDFFF))
+    {
+      return false;
+    }
+  
+  p_pointCode = pointCode;
+  p_position += longueur;
+  return true;
 }
 
 /** 
  * \brief valide le format d'un nom
+ *        Un nom est fait de lettres ASCII et de lettres accentuées de LETTRE_ACCENT encodées
+ *        en UTF-8, séparées par des espaces ou des traits d'union simples. Il ne peut
+ *        débuter ni se terminer par un séparateur.
  * \param[in] p_nom une chaîne de caractère repésentant un nom
  * \return un booléen indiquant si le nom contient des caractère spéciaux ou chiffres ou non
  */
-bool validerFormatNom(const std::string& p_nom)
+bool validerFormatNom(std::string_view p_nom)
 {
   bool valide = false;
   
   if (!p_nom.empty()) 
     {
-      if (p_nom.front() != ' ' && p_nom.front() != '-' && p_nom.back() != ' ' && p_nom.back() != '-' ) 
+      if (classeDe(p_nom.front()) != SEPARATEUR && classeDe(p_nom.back()) != SEPARATEUR) 
         {
-          char lettrePrecedente = '\0';
+          bool separateurPrecedent = false;
           bool caractereInvalide = false;
-          for (char c : p_nom) 
-            { 
-              if (std::isalpha(c) || validerLettreAccent(c)) 
-                {
-                  lettrePrecedente = c; 
-                }
-              
-              else if (c ==' ' || c == '-')  
+          std::size_t position = 0;
+          while (position < p_nom.size() && !caractereInvalide)
+            {
+              switch (classeDe(p_nom[position]))
                 {
-                  if (lettrePrecedente == ' ' || lettrePrecedente == '-') 
-                    {
-                      caractereInvalide = true; 
-                    } 
-                lettrePrecedente = c; 
+                case LETTRE:
+                  separateurPrecedent = false;
+                  position++;
+                  break;
+                  
+                case SEPARATEUR:
+                  caractereInvalide = separateurPrecedent;
+                  separateurPrecedent = true;
+                  position++;
+                  break;
+                  
+                case NON_ASCII:
+                  {
+                    char32_t pointCode;
+                    caractereInvalide = !(decoderUtf8(p_nom, position, pointCode) && estLettreAccentuee(pointCode));
+                    separateurPrecedent = false;
+                    break;
+                  }
+                  
+                default:
+                  caractereInvalide = true;
                 }
-              
-               else
-                 {
-                   caractereInvalide = true; 
-                 }
             }
           
-          if (caractereInvalide == false) 
-            {
-              valide = true; 
-            }
-                                      
+          valide = !caractereInvalide;
         } 
-      
     }
   return valide;
 }
 
 /** 
- * \brief valide le jour, mois et l'année 
+ * \brief valide le format d'une colonne de noms, par exemple lors d'une importation
+ *        Les noms ASCII sont validés par blocs de 16 octets (SSE2 lorsque disponible),
+ *        les noms contenant des lettres accentuées passent par validerFormatNom.
+ * \param[in] p_noms les noms à valider
+ * \return la carte de bits du résultat, le bit i%64 du mot i/64 étant à 1 si le nom i est valide
+ */
+std::vector<std::uint64_t> validerColonneNoms(const std::vector<std::string_view>& p_noms)
+{
+  std::vector<std::uint64_t> valides((p_noms.size() + 63) / 64, 0);
+  
+  for (std::size_t i = 0; i < p_noms.size(); i++)
+    {
+      std::string_view nom = p_noms[i];
+      bool valide = false;
+      if (!nom.empty() && classeDe(nom.front()) != SEPARATEUR && classeDe(nom.back()) != SEPARATEUR)
+        {
+          VerdictNom verdict = validerNomVectoriel(nom);
+          valide = verdict == NOM_VALIDE || (verdict == NOM_NON_ASCII && validerFormatNom(nom));
+        }
+      if (valide)
+        {
+          valides[i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+    }
+  return valides;
+}
+
+/** 
+ * \brief valide le jour, mois et l'année selon le calendrier réel
+ *        Règle commune à validerFormatDate et à lireDate: une année positive
+ *        et une date existante selon Date::validerDate.
  * \param[in] jour un entier représentant le jour
  * \param[in] mois un entier représentant le mois
  * \param[in] annee un entier représentant le annee
@@ -94,7 +433,7 @@ bool validerFormatNom(const std::string& p_nom)
  */
 bool validerJourMoisAnnee (int jour, int mois, int annee)
 {
-  return (jour > 0 && jour <= 31) && (mois > 0 && mois <=12) && (annee > 0 && annee <= 2025);
+  return annee > 0 && Date::validerDate(jour, mois, annee);
 }
 
 /**
@@ -105,40 +444,78 @@ bool validerJourMoisAnnee (int jour, int mois, int annee)
  * \param[in] p_annee un entier représentant l'année de la date
  * \return un booléen indiquant si la date est valide ou non
  */
-bool validerFormatDate (const std::string& p_ligne, int& p_jour, int& p_mois, int& p_annee)
+bool validerFormatDate (std::string_view p_ligne, int& p_jour, int& p_mois, int& p_annee)
 {
   bool dateValide = false;
   
-  if (p_ligne.length() == 10)
+  if (p_ligne.length() == 10 && decoderChampDate(p_ligne.data(), p_jour, p_mois, p_annee))
     {
-      if (p_ligne[2] == ' ' && p_ligne[5] == ' ')
-        {
-          for (int i = 0; i < p_ligne.length(); i++)
-            {
-              if (i != 2 || i != 5)
-                {
-                  if (isdigit(p_ligne[i]))
-                    {
-                      dateValide = true;
-                    }
-                } 
-            }
-          if (dateValide == true)
-            {
-              p_jour = stoi(p_ligne.substr(0, 2));
-              p_mois = stoi(p_ligne.substr(3, 2));
-              p_annee = stoi(p_ligne.substr(6, 4));
-              
-              dateValide = validerJourMoisAnnee(p_jour, p_mois, p_annee);
-            }
-          
-        } else {dateValide = false; }
-      
-    } else {dateValide = false; }
+      dateValide = validerJourMoisAnnee(p_jour, p_mois, p_annee);
+    }
   
   return dateValide;
 }
 
+/**
+ * \brief Valide et convertit en une seule passe un champ date "JJ MM AAAA"
+ * \param[in] p_champ le champ à lire, sans fin de ligne
+ * \param[out] p_date reçoit la date lue si le champ est valide, inchangée sinon
+ * \return un booléen indiquant si le champ représente une date valide
+ */
+bool lireDate (std::string_view p_champ, Date& p_date)
+{
+  int jour;
+  int mois;
+  int annee;
+  bool valide = false;
+  
+  if (p_champ.length() == 10 && decoderChampDate(p_champ.data(), jour, mois, annee))
+    {
+      if (validerJourMoisAnnee(jour, mois, annee))
+        {
+          p_date.asgDate(jour, mois, annee);
+          valide = true;
+        }
+    }
+  return valide;
+}
+
+/**
+ * \brief Indique si un rang de la colonne contenait une date valide
+ * \param[in] p_rang le rang dans la colonne lue
+ * \return un booléen indiquant si la date du rang est valide
+ */
+bool ColonneDates::estValide(std::size_t p_rang) const
+{
+  return (m_valides[p_rang / 64] >> (p_rang % 64)) & 1u;
+}
+
+/**
+ * \brief Lit une colonne de champs date "JJ MM AAAA", par exemple lors d'une importation
+ * \param[in] p_colonne les champs à lire
+ * \return les dates lues et la carte de bits de validité de chaque rang
+ */
+ColonneDates lireColonneDates (const std::vector<std::string_view>& p_colonne)
+{
+  static const Date DATE_INVALIDE(1, 1, 1970);
+  
+  ColonneDates resultat;
+  resultat.m_dates.reserve(p_colonne.size());
+  resultat.m_valides.assign((p_colonne.size() + 63) / 64, 0);
+  
+  for (std::size_t i = 0; i < p_colonne.size(); i++)
+    {
+      Date date = DATE_INVALIDE;
+      if (lireDate(p_colonne[i], date))
+        {
+          resultat.m_valides[i / 64] |= std::uint64_t(1) << (i % 64);
+          resultat.m_nbValides++;
+        }
+      resultat.m_dates.push_back(date);
+    }
+  return resultat;
+}
+
 /** 
  * \brief valide le format d'un fichier de données texte
  * \param[in] p_is une chaîne de caractère repésentant un flux d'entrée 
@@ -146,6 +523,7 @@ bool validerFormatDate (const std::string& p_ligne, int& p_jour, int& p_mois, in
  */
 bool validerFormatFichier(std::istream& p_is)
 {
+  MESURER_LATENCE(VALIDATION_FICHIER);
   bool valide = false;
   string ligne;
   bool ligneInvalide = false;
@@ -164,10 +542,11 @@ bool validerFormatFichier(std::istream& p_is)
               {              
                 if (getline(p_is, ligne) && !ligne.empty()) // 4e ligne - TELEPHONE 
                   {
-                    if (getline(p_is, ligne) && !ligne.empty()) // 5e ligne - FOLIO   
+                    unsigned noFolio;
+                    if (getline(p_is, ligne) && lireNoFolio(ligne, noFolio) == ErreurNombre::AUCUNE) // 5e ligne - FOLIO   
                     {
                       ligneInvalide = false; // lignes des fichiers sont valides 
-                    }                                        
+                    } else { ligneInvalide = true; }
                 } else { ligneInvalide = true; }  
                             
               } else { ligneInvalide = true; }     
@@ -187,29 +566,27 @@ bool validerFormatFichier(std::istream& p_is)
         {         
           if (ligne == "cheque") //**
             {
-              if (getline(p_is, ligne) && !ligne.empty()) // 7e ligne - NUMCOMPTE
+              unsigned int numCompte; 
+              if (getline(p_is, ligne) && lireNoCompte(ligne, numCompte) == ErreurNombre::AUCUNE) // 7e ligne - NUMCOMPTE
                 {
-                  unsigned int numCompte; 
-                  
-                  if (getline(p_is, ligne) && !ligne.empty()) // 8e ligne - TAUX INTERET
+                  double tauxInteret = 0.0; 
+                  if (getline(p_is, ligne) && lireTaux(ligne, tauxInteret) == ErreurNombre::AUCUNE) // 8e ligne - TAUX INTERET
                     {
-                      double tauxInteret = 0.0; 
                   
-                    if (getline(p_is, ligne) && !ligne.empty()) // 9e ligne - SOLDE
+                    double solde = 0.00; 
+                    if (getline(p_is, ligne) && lireSolde(ligne, solde) == ErreurNombre::AUCUNE) // 9e ligne - SOLDE
                       {
-                        double solde = 0.00; 
                       
                         if (getline(p_is, ligne) && !ligne.empty()) // 10e ligne - DESCRIPTION
                           {
                             string description;
                             
-                            if (getline(p_is, ligne) && !ligne.empty()) // 11e ligne - TRANSACTIONS
+                            unsigned int nbrTransactions = 0; 
+                            if (getline(p_is, ligne) && lireNbrTransactions(ligne, nbrTransactions) == ErreurNombre::AUCUNE) // 11e ligne - TRANSACTIONS
                               {
-                                unsigned int nbrTransactions = 0; 
-                                
-                                if (getline(p_is, ligne) && !ligne.empty()) // 12 ligne - MINTAUXINTERET
+                                double minTauxInteret = 0.0; 
+                                if (getline(p_is, ligne) && lireTaux(ligne, minTauxInteret) == ErreurNombre::AUCUNE) // 12 ligne - MINTAUXINTERET
                                   {
-                                    double minTauxInteret = 0.0; 
                                     ligneCompteInvalide = false;
                                     ligneInvalide = false;
                                   }
@@ -229,17 +606,16 @@ bool validerFormatFichier(std::istream& p_is)
          
            else if (ligne == "epargne")
             {
-              if (getline(p_is, ligne) && !ligne.empty()) // 7e ligne - NUMCOMPTE
+              unsigned int numCompte; 
+              if (getline(p_is, ligne) && lireNoCompte(ligne, numCompte) == ErreurNombre::AUCUNE) // 7e ligne - NUMCOMPTE
                 {
-                  unsigned int numCompte; 
-                  
-                  if (getline(p_is, ligne) && !ligne.empty()) // 8e ligne - TAUX INTERET
+                  double tauxInteret = 0.0; 
+                  if (getline(p_is, ligne) && lireTaux(ligne, tauxInteret) == ErreurNombre::AUCUNE) // 8e ligne - TAUX INTERET
                     {
-                      double tauxInteret = 0.0; 
                   
-                     if (getline(p_is, ligne) && !ligne.empty()) // 9e ligne - SOLDE
+                     double solde = 0.00;
+                     if (getline(p_is, ligne) && lireSolde(ligne, solde) == ErreurNombre::AUCUNE) // 9e ligne - SOLDE
                       {
-                        double solde = 0.00; //
                       
                         if (getline(p_is, ligne) && !ligne.empty()) // 10e ligne - DESCRIPTION
                           {
@@ -292,42 +668,134 @@ bool validerFormatFichier(std::istream& p_is)
  */
 bool validerNombre(std::string& p_nombre)
 {
-  if (p_nombre.empty())
+  double nombre;
+  return lireDecimal(p_nombre, nombre) == ErreurNombre::AUCUNE;
+}
+
+/** 
+ * \brief Valide et convertit en une seule passe un numéro de folio
+ * \param[in] p_champ le champ à lire
+ * \param[out] p_noFolio reçoit le numéro lu, inchangé en cas d'erreur
+ * \return ErreurNombre::HORS_LIMITES si le numéro n'est pas dans [1000, 10000[
+ */
+ErreurNombre lireNoFolio(std::string_view p_champ, unsigned& p_noFolio)
+{
+  unsigned noFolio;
+  ErreurNombre erreur = lireEntier(p_champ, noFolio);
+  if (erreur == ErreurNombre::AUCUNE)
     {
-      return false;
+      if (noFolio >= 1000 && noFolio < 10000)
+        {
+          p_noFolio = noFolio;
+        }
+      else { erreur = ErreurNombre::HORS_LIMITES; }
     }
-  
-  bool point = false;
-  bool nombre = false;
-  bool negatif = false;
-  for (char c : p_nombre)
+  return erreur;
+}
+
+/** 
+ * \brief Valide et convertit en une seule passe un numéro de compte
+ * \param[in] p_champ le champ à lire
+ * \param[out] p_noCompte reçoit le numéro lu, inchangé en cas d'erreur
+ * \return ErreurNombre::HORS_LIMITES si le numéro est 0
+ */
+ErreurNombre lireNoCompte(std::string_view p_champ, unsigned& p_noCompte)
+{
+  unsigned noCompte;
+  ErreurNombre erreur = lireEntier(p_champ, noCompte);
+  if (erreur == ErreurNombre::AUCUNE)
     {
-      if (c == '.')
+      if (noCompte > 0)
         {
-          if (point)
-            {
-              return false;
-              point = true;
-            }
+          p_noCompte = noCompte;
         }
-      else if (p_nombre[0] == '-')
+      else { erreur = ErreurNombre::HORS_LIMITES; }
+    }
+  return erreur;
+}
+
+/** 
+ * \brief Valide et convertit en une seule passe le nombre de transactions d'un compte cheque
+ * \param[in] p_champ le champ à lire
+ * \param[out] p_nombreTransactions reçoit le nombre lu, inchangé en cas d'erreur
+ * \return ErreurNombre::HORS_LIMITES si le nombre dépasse 40
+ */
+ErreurNombre lireNbrTransactions(std::string_view p_champ, unsigned& p_nombreTransactions)
+{
+  unsigned nombreTransactions;
+  ErreurNombre erreur = lireEntier(p_champ, nombreTransactions);
+  if (erreur == ErreurNombre::AUCUNE)
+    {
+      if (nombreTransactions <= 40)
         {
-          if(negatif)
-            {
-              return false;
-              negatif = true;
-            }
+          p_nombreTransactions = nombreTransactions;
         }
-      else if (!isdigit(c))
+      else { erreur = ErreurNombre::HORS_LIMITES; }
+    }
+  return erreur;
+}
+
+/** 
+ * \brief Valide et convertit en une seule passe un taux d'intérêt
+ * \param[in] p_champ le champ à lire, en notation décimale avec un point
+ * \param[out] p_taux reçoit le taux lu, inchangé en cas d'erreur
+ * \return ErreurNombre::HORS_LIMITES si le taux est négatif
+ */
+ErreurNombre lireTaux(std::string_view p_champ, double& p_taux)
+{
+  double taux;
+  ErreurNombre erreur = lireDecimal(p_champ, taux);
+  if (erreur == ErreurNombre::AUCUNE)
+    {
+      if (taux >= 0.0)
         {
-          return false;
-        }   
-      else
+          p_taux = taux;
+        }
+      else { erreur = ErreurNombre::HORS_LIMITES; }
+    }
+  return erreur;
+}
+
+/** 
+ * \brief Valide et convertit en une seule passe un solde, positif ou négatif
+ * \param[in] p_champ le champ à lire, en notation décimale avec un point
+ * \param[out] p_solde reçoit le solde lu, inchangé en cas d'erreur
+ * \return ErreurNombre::AUCUNE si le champ est un nombre décimal fini
+ */
+ErreurNombre lireSolde(std::string_view p_champ, double& p_solde)
+{
+  return lireDecimal(p_champ, p_solde);
+}
+
+/** 
+ * \brief Normalise un numéro de téléphone local en un entier de 10 chiffres
+ *        Les caractères autres que des chiffres (espaces, tirets, parenthèses) sont ignorés.
+ * \param[in] p_champ le numéro tel que saisi
+ * \param[out] p_noTelephone reçoit les 10 chiffres sous forme d'entier, inchangé en cas d'erreur
+ * \return ErreurNombre::FORMAT si le champ ne contient pas exactement 10 chiffres
+ */
+ErreurNombre lireTelephone(std::string_view p_champ, std::uint64_t& p_noTelephone)
+{
+  if (p_champ.empty())
+    {
+      return ErreurNombre::VIDE;
+    }
+  std::uint64_t noTelephone = 0;
+  int nbChiffres = 0;
+  for (char c : p_champ)
+    {
+      if (estChiffre(c))
         {
-          nombre = true;
+          noTelephone = noTelephone * 10 + (c - '0');
+          nbChiffres++;
         }
     }
-  return true;
+  if (nbChiffres != 10)
+    {
+      return ErreurNombre::FORMAT;
+    }
+  p_noTelephone = noTelephone;
+  return ErreurNombre::AUCUNE;
 }
 
 
@@ -10,22 +10,62 @@
 #define VALIDATIONFORMAT_H
 #include<iostream>
 #include<string>
+#include<string_view>
 #include<array>
+#include<vector>
+#include<cstdint>
+
+#include "Date.h"
 
 namespace util
 {
-const char LETTRE_ACCENT[] = "ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÑÒÓÔÕÖÙÚÛÜÝàáâãäåæçèéêëìíîïñòóôõöùúûüýÿ";
+constexpr char LETTRE_ACCENT[] = "ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÑÒÓÔÕÖÙÚÛÜÝàáâãäåæçèéêëìíîïñòóôõöùúûüýÿ";
 bool validerLettreAccent(char c);
+bool estLettreAccentuee(char32_t p_pointCode);
+bool decoderUtf8(std::string_view p_texte, std::size_t& p_position, char32_t& p_pointCode);
 
-bool validerFormatNom(const std::string& p_nom); 
+bool validerFormatNom(std::string_view p_nom); 
+std::vector<std::uint64_t> validerColonneNoms(const std::vector<std::string_view>& p_noms);
         
 bool validerJourMoisAnnee (int jour, int mois, int annee);
-bool validerFormatDate (const std::string& p_ligne, int& p_jour, int& p_mois, int& p_annee);
+bool validerFormatDate (std::string_view p_ligne, int& p_jour, int& p_mois, int& p_annee);
+bool lireDate (std::string_view p_champ, Date& p_date);
+
+/**
+ * \struct ColonneDates
+ * \brief Résultat de la lecture d'une colonne de dates "JJ MM AAAA".
+ *
+ *              m_dates contient une date par rang de la colonne. Un rang invalide
+ *              reçoit la date 01/01/1970 et son bit est à 0 dans m_valides
+ *              (bit i%64 du mot i/64).
+ */
+struct ColonneDates
+{
+  std::vector<Date> m_dates;
+  std::vector<std::uint64_t> m_valides;
+  std::size_t m_nbValides = 0;
+
+  bool estValide(std::size_t p_rang) const;
+};
+ColonneDates lireColonneDates (const std::vector<std::string_view>& p_colonne);
 
 bool validerFormatFichier(std::istream& p_is);
 
 bool validerNombre(std::string& p_nombre);
 
+/**
+ * \enum ErreurNombre
+ * \brief Résultat de la lecture d'un champ numérique.
+ */
+enum class ErreurNombre { AUCUNE, VIDE, FORMAT, HORS_LIMITES };
+
+ErreurNombre lireNoFolio(std::string_view p_champ, unsigned& p_noFolio);
+ErreurNombre lireNoCompte(std::string_view p_champ, unsigned& p_noCompte);
+ErreurNombre lireNbrTransactions(std::string_view p_champ, unsigned& p_nombreTransactions);
+ErreurNombre lireTaux(std::string_view p_champ, double& p_taux);
+ErreurNombre lireSolde(std::string_view p_champ, double& p_solde);
+ErreurNombre lireTelephone(std::string_view p_champ, std::uint64_t& p_noTelephone);
+
 } // namespace util
 
 #endif /* VALIDATIONFORMAT_H */
\ No newline at end of file